@@ -25,8 +25,10 @@
 #include "accl.h"
 #include "push.h"
 #include "flash.h"
+#include "history.h"
 
 bool stepsWhereReseted = false;
+int alwaysOnMinute = -1;
 
 void setup() {
   delay(500);
@@ -71,10 +73,15 @@ void loop() {
     check_battery_status();// check battery status. if lower than XX show message
   }
   if (get_timed_int()) {//Theorecticly every 40ms via RTC2 but since the display takes longer its not accurate at all when display on
+    time_data_struct time_data = get_time();
     if (get_sleep()) {
       if (acc_input())sleep_up(WAKEUP_ACCL);//check if the hand was lifted and turn on the display if so
+      else if (get_always_on() && time_data.min != alwaysOnMinute) {//the always on clock only changes once a minute
+        alwaysOnMinute = time_data.min;
+        display_screen(true);
+      }
     }
-    time_data_struct time_data = get_time();
+    check_timed_history(time_data.min);//store a record every 15 minutes, before the steps of the day are reset
     if (time_data.hr == 0) {// check for new day
       if (!stepsWhereReseted) {//reset steps on a new day
         stepsWhereReseted = true;
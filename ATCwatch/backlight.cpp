@@ -74,6 +74,12 @@ void set_backlight(int brightness) {
   }
 }
 
+void dim_backlight() {//lowest level, the brightness that is set stays
+  int brightness = backlight_brightness;
+  set_backlight(min_backlight_brightness);
+  backlight_brightness = brightness;
+}
+
 void inc_backlight() {
   backlight_brightness++;
   if (backlight_brightness > max_backlight_brightness)backlight_brightness = min_backlight_brightness;
@@ -7,5 +7,6 @@ void init_backlight();
 void set_backlight();
 int get_backlight();
 void set_backlight(int brightness);
+void dim_backlight();
 void inc_backlight();
 void dec_backlight();
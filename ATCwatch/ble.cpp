@@ -10,6 +10,11 @@
 #include "bootloader.h"
 #include "push.h"
 #include "accl.h"
+#include "ble_rx.h"
+#include "ble_tx.h"
+#include "ble_frame.h"
+#include "heartrate.h"
+#include "history.h"
 
 BLEPeripheral                   blePeripheral           = BLEPeripheral();
 BLEService                      main_service     = BLEService("190A");
@@ -35,9 +40,22 @@ void init_ble() {
 
 void ble_feed() {
   blePeripheral.poll();
+  ble_sync_feed();
+  ble_send();
+}
+
+void ble_send() {
+  //hands queued data to the stack while it has buffers free, the rest waits for the next ble_feed()
+  uint8_t packet[BLE_TX_PACKET];
+  while (get_vars_ble_connected() && TXchar.canNotify()) {
+    uint32_t length = ble_tx_peek(packet);
+    if (!length || !TXchar.setValue(packet, length))break;
+    ble_tx_pop(length);
+  }
 }
 
 void ble_ConnectHandler(BLECentral& central) {
+  ble_rx_reset();//a command cut off by the last disconnect must not stick to the first one
   sleep_up(WAKEUP_BLECONNECTED);
   set_vars_ble_connected(true);
 }
@@ -45,37 +63,24 @@ void ble_ConnectHandler(BLECentral& central) {
 void ble_DisconnectHandler(BLECentral& central) {
   sleep_up(WAKEUP_BLEDISCONNECTED);
   set_vars_ble_connected(false);
+  ble_tx_reset();//answers for the last central are of no use to the next one
+  ble_sync_stop();
 }
 
-String answer = "";
-String tempCmd = "";
-int tempLen = 0, tempLen1;
-boolean syn;
-
 void ble_written(BLECentral& central, BLECharacteristic& characteristic) {
-  char remoteCharArray[22];
-  tempLen1 = characteristic.valueLength();
-  tempLen = tempLen + tempLen1;
-  memset(remoteCharArray, 0, sizeof(remoteCharArray));
-  memcpy(remoteCharArray, characteristic.value(), tempLen1);
-  tempCmd = tempCmd + remoteCharArray;
-  if (tempCmd[tempLen - 2] == '\r' && tempCmd[tempLen - 1] == '\n') {
-    answer = tempCmd.substring(0, tempLen - 2);
-    tempCmd = "";
-    tempLen = 0;
-    filterCmd(answer);
+  ble_rx_push(characteristic.value(), characteristic.valueLength());
+  ble_command_struct command;
+  while (ble_rx_next(&command)) {
+    if (command.binary)
+      filterFrame((const uint8_t *)command.text, command.length);
+    else
+      filterCmd(command.text, command.length);
   }
 }
 
 void ble_write(String Command) {
-  Command = Command + "\r\n";
-  while (Command.length() > 0) {
-    const char* TempSendCmd;
-    String TempCommand = Command.substring(0, 20);
-    TempSendCmd = &TempCommand[0];
-    TXchar.setValue(TempSendCmd);
-    Command = Command.substring(20);
-  }
+  ble_tx_push_line(Command.c_str(), Command.length());
+  ble_send();
 }
 
 bool get_vars_ble_connected() {
@@ -87,54 +92,304 @@ void set_vars_ble_connected(bool state) {
 }
 
 
-void filterCmd(String Command) {
-  if (Command == "AT+BOND") {
-    ble_write("AT+BOND:OK");
-  } else if (Command == "AT+ACT") {
-    ble_write("AT+ACT:0");
-  } else if (Command.substring(0, 7) == "BT+UPGB") {
-    start_bootloader();
-  } else if (Command.substring(0, 8) == "BT+RESET") {
-    set_reboot();
-  } else if (Command.substring(0, 7) == "AT+RUN=") {
-    ble_write("AT+RUN:" + Command.substring(7));
-  } else if (Command.substring(0, 8) == "AT+USER=") {
-    ble_write("AT+USER:" + Command.substring(8));
-  } else if (Command == "AT+PACE") {
-    accl_data_struct accl_data = get_accl_data();
-    ble_write("AT+PACE:" + String(accl_data.steps));
-  } else if (Command == "AT+BATT") {
-    ble_write("AT+BATT:" + String(get_battery_percent()));
-  } else if (Command.substring(0, 8) == "AT+PUSH=") {
-    ble_write("AT+PUSH:OK");
-    show_push(Command.substring(8));
-  } else if (Command == "BT+VER") {
-    ble_write("BT+VER:P8");
-  } else if (Command == "AT+VER") {
-    ble_write("AT+VER:P8");
-  } else if (Command == "AT+SN") {
-    ble_write("AT+SN:P8");
-  } else if (Command.substring(0, 12) == "AT+CONTRAST=") {
-    String contrastTemp = Command.substring(12);
-    if (contrastTemp == "100")
-      set_backlight(1);
-    else if (contrastTemp == "175")
-      set_backlight(3);
-    else set_backlight(7);
-    ble_write("AT+CONTRAST:" + Command.substring(12));
-  } else if (Command.substring(0, 10) == "AT+MOTOR=1") {
-    String motor_power = Command.substring(10);
-    if (motor_power == "1")
-      set_motor_power(50);
-    else if (motor_power == "2")
-      set_motor_power(200);
-    else set_motor_power(350);
-    ble_write("AT+MOTOR:1" + Command.substring(10));
-    set_motor_ms();
-  } else if (Command.substring(0, 6) == "AT+DT=") {
-    SetDateTimeString(Command.substring(6));
-    ble_write("AT+DT:" + GetDateTimeString());
-  } else if (Command.substring(0, 5) == "AT+DT") {
-    ble_write("AT+DT:" + GetDateTimeString());
+//commands are found through a hash of their first letter and the two after the "+", every name is at least
+//5 letters long. A bucket holds the few commands that share it in table order, the name is compared only then
+#define BLE_COMMAND_EXACT 0
+#define BLE_COMMAND_PREFIX 1//the rest of the command is handed to the handler
+#define BLE_COMMAND_BUCKETS 32
+#define BLE_COMMAND_MIN_NAME 5
+
+struct ble_handler_struct {
+  const char *name;
+  uint8_t match;
+  void (*handler)(const char *argument, uint32_t length);//argument points into the received command
+};
+
+String argumentString(const char *argument, uint32_t length) {
+  //exactly length bytes, the handlers do not rely on the command being terminated after the argument
+  String text;
+  text.reserve(length);
+  for (uint32_t i = 0; i < length; i++)text += argument[i];
+  return text;
+}
+
+void cmd_bond(const char *argument, uint32_t length) {
+  ble_write("AT+BOND:OK");
+}
+
+void cmd_act(const char *argument, uint32_t length) {
+  ble_write("AT+ACT:0");
+}
+
+void cmd_upgrade(const char *argument, uint32_t length) {
+  start_bootloader();
+}
+
+void cmd_reset(const char *argument, uint32_t length) {
+  set_reboot();
+}
+
+void cmd_run(const char *argument, uint32_t length) {
+  ble_write("AT+RUN:" + argumentString(argument, length));
+}
+
+void cmd_user(const char *argument, uint32_t length) {
+  ble_write("AT+USER:" + argumentString(argument, length));
+}
+
+void cmd_pace(const char *argument, uint32_t length) {
+  accl_data_struct accl_data = get_accl_data();
+  ble_write("AT+PACE:" + String(accl_data.steps));
+}
+
+void cmd_batt(const char *argument, uint32_t length) {
+  ble_write("AT+BATT:" + String(get_battery_percent()));
+}
+
+void cmd_push(const char *argument, uint32_t length) {
+  ble_write("AT+PUSH:OK");
+  show_push(argumentString(argument, length));
+}
+
+void cmd_bt_ver(const char *argument, uint32_t length) {
+  ble_write("BT+VER:P8");
+}
+
+void cmd_ver(const char *argument, uint32_t length) {
+  ble_write("AT+VER:P8");
+}
+
+void cmd_sn(const char *argument, uint32_t length) {
+  ble_write("AT+SN:P8");
+}
+
+void cmd_contrast(const char *argument, uint32_t length) {
+  if (length == 3 && !memcmp(argument, "100", 3))
+    set_backlight(1);
+  else if (length == 3 && !memcmp(argument, "175", 3))
+    set_backlight(3);
+  else set_backlight(7);
+  ble_write("AT+CONTRAST:" + argumentString(argument, length));
+}
+
+void cmd_motor(const char *argument, uint32_t length) {
+  if (length == 1 && argument[0] == '1')
+    set_motor_power(50);
+  else if (length == 1 && argument[0] == '2')
+    set_motor_power(200);
+  else set_motor_power(350);
+  ble_write("AT+MOTOR:1" + argumentString(argument, length));
+  set_motor_ms();
+}
+
+void cmd_set_time(const char *argument, uint32_t length) {
+  SetDateTimeString(argumentString(argument, length));
+  ble_write("AT+DT:" + GetDateTimeString());
+}
+
+void cmd_time(const char *argument, uint32_t length) {
+  ble_write("AT+DT:" + GetDateTimeString());
+}
+
+const ble_handler_struct ble_handlers[] = {
+  {"AT+BOND", BLE_COMMAND_EXACT, cmd_bond},
+  {"AT+ACT", BLE_COMMAND_EXACT, cmd_act},
+  {"BT+UPGB", BLE_COMMAND_PREFIX, cmd_upgrade},
+  {"BT+RESET", BLE_COMMAND_PREFIX, cmd_reset},
+  {"AT+RUN=", BLE_COMMAND_PREFIX, cmd_run},
+  {"AT+USER=", BLE_COMMAND_PREFIX, cmd_user},
+  {"AT+PACE", BLE_COMMAND_EXACT, cmd_pace},
+  {"AT+BATT", BLE_COMMAND_EXACT, cmd_batt},
+  {"AT+PUSH=", BLE_COMMAND_PREFIX, cmd_push},
+  {"BT+VER", BLE_COMMAND_EXACT, cmd_bt_ver},
+  {"AT+VER", BLE_COMMAND_EXACT, cmd_ver},
+  {"AT+SN", BLE_COMMAND_EXACT, cmd_sn},
+  {"AT+CONTRAST=", BLE_COMMAND_PREFIX, cmd_contrast},
+  {"AT+MOTOR=1", BLE_COMMAND_PREFIX, cmd_motor},
+  {"AT+DT=", BLE_COMMAND_PREFIX, cmd_set_time},
+  {"AT+DT", BLE_COMMAND_PREFIX, cmd_time},//after AT+DT= as it matches that one as well
+};
+
+#define BLE_HANDLERS (sizeof(ble_handlers) / sizeof(ble_handlers[0]))
+
+int8_t ble_handler_first[BLE_COMMAND_BUCKETS];
+int8_t ble_handler_next[BLE_HANDLERS];
+bool ble_handlers_hashed = false;
+
+uint32_t hashCommand(const char *command) {
+  return ((uint8_t)command[0] * 7 + (uint8_t)command[3] * 3 + (uint8_t)command[4]) % BLE_COMMAND_BUCKETS;
+}
+
+void hashHandlers() {
+  memset(ble_handler_first, -1, sizeof(ble_handler_first));
+  for (int32_t i = BLE_HANDLERS - 1; i >= 0; i--) {//chained from the back so each bucket keeps the table order
+    uint32_t bucket = hashCommand(ble_handlers[i].name);
+    ble_handler_next[i] = ble_handler_first[bucket];
+    ble_handler_first[bucket] = i;
+  }
+  ble_handlers_hashed = true;
+}
+
+void filterCmd(const char *command, uint32_t length) {
+  if (length < BLE_COMMAND_MIN_NAME)return;
+  if (!ble_handlers_hashed)hashHandlers();
+  for (int32_t i = ble_handler_first[hashCommand(command)]; i >= 0; i = ble_handler_next[i]) {
+    const ble_handler_struct *entry = &ble_handlers[i];
+    uint32_t nameLength = strlen(entry->name);
+    if (nameLength > length || memcmp(command, entry->name, nameLength))continue;
+    if (entry->match == BLE_COMMAND_EXACT && nameLength != length)continue;
+    entry->handler(command + nameLength, length - nameLength);
+    return;
+  }
+}
+
+//binary frames are looked up by their type, the handler answers with ble_write_frame()
+struct ble_frame_handler_struct {
+  uint8_t type;
+  void (*handler)(uint8_t sequence, const uint8_t *value, uint32_t length);
+};
+
+void ble_write_frame(uint8_t sequence, uint8_t type, const uint8_t *value, uint32_t length) {
+  uint8_t frame[BLE_FRAME_MAX_VALUE + BLE_FRAME_OVERHEAD];
+  ble_tx_push(frame, ble_frame_build(frame, sequence, type, value, length));
+  ble_send();
+}
+
+void frameError(uint8_t sequence, uint8_t type, uint8_t reason) {
+  uint8_t value[2] = {type, reason};
+  ble_write_frame(sequence, BLE_FRAME_ERROR, value, 2);
+}
+
+void putValue(uint8_t *value, uint32_t data, uint32_t bytes) {
+  for (uint32_t i = 0; i < bytes; i++)//low byte first
+    value[i] = data >> (i * 8);
+}
+
+void frame_status(uint8_t sequence, const uint8_t *value, uint32_t length) {
+  uint8_t status[9];
+  putValue(&status[0], get_accl_data().steps, 4);
+  status[4] = get_battery_percent();
+  putValue(&status[5], get_battery() * 1000, 2);
+  status[7] = get_last_heartrate();
+  status[8] = get_charge();
+  ble_write_frame(sequence, FRAME_STATUS | BLE_FRAME_REPLY, status, sizeof(status));
+}
+
+uint32_t getValue(const uint8_t *value, uint32_t bytes) {
+  uint32_t data = 0;
+  for (uint32_t i = 0; i < bytes; i++)
+    data |= (uint32_t)value[i] << (i * 8);
+  return data;
+}
+
+void frame_time(uint8_t sequence, const uint8_t *value, uint32_t length) {
+  if (length == 4)
+    set_timestamp(getValue(value, 4));
+  else if (length) {
+    frameError(sequence, FRAME_TIME, FRAME_ERROR_LENGTH);
+    return;
+  }
+  uint8_t timestamp[4];
+  putValue(timestamp, get_timestamp(), 4);
+  ble_write_frame(sequence, FRAME_TIME | BLE_FRAME_REPLY, timestamp, sizeof(timestamp));
+}
+
+//history records are streamed from ble_feed() while the window and the send queue have room
+struct ble_sync_struct {
+  bool active;
+  uint8_t sequence;//of the next data frame
+  uint32_t acked;//index of the first record the phone has not acknowledged
+  uint32_t sent;//index of the next record to send
+  uint32_t end;//index after the last record, fixed when the sync starts
+  uint32_t window;//records that may be unacknowledged
+  uint32_t lastProgress;//millis of the last ack that moved on
+};
+
+ble_sync_struct ble_sync;
+
+void frame_sync(uint8_t sequence, const uint8_t *value, uint32_t length) {
+  if (length != 4 && length != 5) {
+    frameError(sequence, FRAME_SYNC, FRAME_ERROR_LENGTH);
+    return;
+  }
+  uint32_t index = getValue(value, 4);
+  uint32_t first = get_history_first();
+  ble_sync.end = get_history_end();
+  if (index < first)index = first;//overwritten already, start with the oldest one kept
+  if (index > ble_sync.end)index = ble_sync.end;
+  uint32_t frames = ((length == 5 && value[4]) ? value[4] : BLE_SYNC_WINDOW) / BLE_SYNC_FRAME_NOTIFICATIONS;
+  ble_sync.window = (frames ? frames : 1) * BLE_SYNC_FRAME_RECORDS;
+  ble_sync.acked = index;
+  ble_sync.sent = index;
+  ble_sync.lastProgress = millis();
+  ble_sync.active = index < ble_sync.end;
+  uint8_t answer[8];
+  putValue(&answer[0], index, 4);
+  putValue(&answer[4], ble_sync.end, 4);
+  ble_write_frame(sequence, FRAME_SYNC | BLE_FRAME_REPLY, answer, sizeof(answer));
+}
+
+void frame_sync_ack(uint8_t sequence, const uint8_t *value, uint32_t length) {
+  if (length != 4) {
+    frameError(sequence, FRAME_SYNC_ACK, FRAME_ERROR_LENGTH);
+    return;
+  }
+  uint32_t index = getValue(value, 4);
+  if (!ble_sync.active || index > ble_sync.sent)return;//late or not for this sync
+  if (index > ble_sync.acked) {
+    ble_sync.acked = index;
+    ble_sync.lastProgress = millis();
+  } else if (index == ble_sync.acked) {
+    ble_sync.sent = index;//the phone misses this one, go back to it
+  }
+  if (ble_sync.acked >= ble_sync.end)ble_sync.active = false;
+}
+
+void ble_sync_stop() {
+  ble_sync.active = false;//a new central resumes with the index of its last ack
+}
+
+void ble_sync_feed() {
+  if (!ble_sync.active || !get_vars_ble_connected())return;
+  if (millis() - ble_sync.lastProgress > BLE_SYNC_TIMEOUT) {//acks got lost, send it all again
+    ble_sync.sent = ble_sync.acked;
+    ble_sync.lastProgress = millis();
+  }
+  uint32_t first = get_history_first();//records may be overwritten during a long sync
+  if (ble_sync.acked < first)ble_sync.acked = first;
+  if (ble_sync.sent < first)ble_sync.sent = first;
+  uint8_t data[4 + BLE_SYNC_FRAME_RECORDS * HISTORY_RECORD_SIZE];
+  history_record_struct record;
+  while (ble_sync.sent < ble_sync.end && ble_sync.sent - ble_sync.acked < ble_sync.window && ble_tx_free() >= sizeof(data) + BLE_FRAME_OVERHEAD) {
+    uint32_t length = 4;
+    putValue(data, ble_sync.sent, 4);
+    while (length < sizeof(data) && ble_sync.sent < ble_sync.end && get_history_record(ble_sync.sent, &record)) {
+      length += put_history_record(&data[length], record);
+      ble_sync.sent++;
+    }
+    ble_write_frame(ble_sync.sequence++, FRAME_SYNC_DATA, data, length);
+  }
+}
+
+const ble_frame_handler_struct ble_frame_handlers[] = {
+  {FRAME_STATUS, frame_status},
+  {FRAME_TIME, frame_time},
+  {FRAME_SYNC, frame_sync},
+  {FRAME_SYNC_ACK, frame_sync_ack},
+};
+
+void filterFrame(const uint8_t *frame, uint32_t length) {
+  uint8_t sequence = frame[1];
+  uint8_t type = frame[2];
+  if (!ble_frame_check(frame, length)) {
+    frameError(sequence, type, FRAME_ERROR_CRC);
+    return;
+  }
+  for (uint32_t i = 0; i < sizeof(ble_frame_handlers) / sizeof(ble_frame_handlers[0]); i++) {
+    if (ble_frame_handlers[i].type == type) {
+      ble_frame_handlers[i].handler(sequence, &frame[BLE_FRAME_HEADER], frame[3]);
+      return;
+    }
   }
+  frameError(sequence, type, FRAME_ERROR_TYPE);
 }
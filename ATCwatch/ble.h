@@ -5,6 +5,9 @@
 
 void init_ble();
 void ble_feed();
+void ble_send();
+void ble_sync_feed();
+void ble_sync_stop();
 void ble_ConnectHandler(BLECentral& central);
 void ble_DisconnectHandler(BLECentral& central);
 void ble_DisconnectHandler(BLECentral& central);
@@ -12,4 +15,6 @@ void ble_written(BLECentral& central, BLECharacteristic& characteristic);
 void ble_write(String Command);
 bool get_vars_ble_connected();
 void set_vars_ble_connected(bool state);
-void filterCmd(String Command);
+void filterCmd(const char *command, uint32_t length);
+void filterFrame(const uint8_t *frame, uint32_t length);
+void ble_write_frame(uint8_t sequence, uint8_t type, const uint8_t *value, uint32_t length);
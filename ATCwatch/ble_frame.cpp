@@ -0,0 +1,31 @@
+#include "ble_frame.h"
+
+uint16_t ble_frame_crc(const uint8_t *data, uint32_t length) {
+  uint16_t crc = 0xFFFF;
+  for (uint32_t i = 0; i < length; i++) {
+    crc ^= data[i] << 8;
+    for (uint32_t bit = 0; bit < 8; bit++)
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+bool ble_frame_check(const uint8_t *frame, uint32_t length) {
+  //length is the whole frame as handed out by ble_rx_next()
+  if (length < BLE_FRAME_OVERHEAD || length - BLE_FRAME_OVERHEAD != frame[3])return false;
+  uint16_t crc = ble_frame_crc(&frame[1], length - 3);
+  return frame[length - 2] == (crc & 0xFF) && frame[length - 1] == (crc >> 8);
+}
+
+uint32_t ble_frame_build(uint8_t *frame, uint8_t sequence, uint8_t type, const uint8_t *value, uint32_t length) {
+  //frame needs room for length + BLE_FRAME_OVERHEAD bytes, returns the bytes used
+  frame[0] = BLE_FRAME_MAGIC;
+  frame[1] = sequence;
+  frame[2] = type;
+  frame[3] = length;
+  memcpy(&frame[BLE_FRAME_HEADER], value, length);
+  uint16_t crc = ble_frame_crc(&frame[1], length + 3);
+  frame[BLE_FRAME_HEADER + length] = crc;
+  frame[BLE_FRAME_HEADER + length + 1] = crc >> 8;
+  return length + BLE_FRAME_OVERHEAD;
+}
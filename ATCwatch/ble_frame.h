@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Arduino.h"
+
+//binary frames share the characteristics with the AT commands, they start with a byte no command starts with:
+//magic, sequence number, type, value length, value, CRC-16/CCITT of sequence number to value, low byte first
+#define BLE_FRAME_MAGIC 0xAB
+#define BLE_FRAME_HEADER 4
+#define BLE_FRAME_OVERHEAD 6
+#define BLE_FRAME_MAX_VALUE 255
+#define BLE_FRAME_REPLY 0x80//set in the type of an answer, the sequence number is the one of the request
+#define BLE_FRAME_ERROR 0xFF//value is the type of the request and the reason
+
+#define FRAME_STATUS 0x01//steps u32, battery % u8, battery mV u16, last heart rate u8, charging u8
+#define FRAME_TIME 0x02//seconds since 1970 u32, sent with a value it sets the time first
+#define FRAME_SYNC 0x03//history index to start at u32, window in notifications u8 optional, answered with the first index sent u32 and the end u32
+#define FRAME_SYNC_DATA 0x04//from the watch only: index of the first record u32 followed by up to BLE_SYNC_FRAME_RECORDS records
+#define FRAME_SYNC_ACK 0x05//index of the next record the phone waits for u32, not answered
+
+//a history sync keeps at most a window of records unacknowledged, an ack covers every record before the index it
+//names. The same ack twice means the phone missed a frame and everything from there is sent again
+#define BLE_SYNC_FRAME_RECORDS 5//a full data frame of 60 bytes fills 3 notifications
+#define BLE_SYNC_FRAME_NOTIFICATIONS 3
+#define BLE_SYNC_WINDOW 24//notifications in flight when the request names no window
+#define BLE_SYNC_TIMEOUT 1000//ms without an ack that moves on before the unacknowledged records are sent again
+
+#define FRAME_ERROR_CRC 1
+#define FRAME_ERROR_TYPE 2
+#define FRAME_ERROR_LENGTH 3
+
+uint16_t ble_frame_crc(const uint8_t *data, uint32_t length);
+bool ble_frame_check(const uint8_t *frame, uint32_t length);
+uint32_t ble_frame_build(uint8_t *frame, uint8_t sequence, uint8_t type, const uint8_t *value, uint32_t length);
@@ -0,0 +1,123 @@
+#include "ble_rx.h"
+#include "ble_frame.h"
+
+//the written chunks are collected in a ring, complete commands are handed out as views into it.
+//Only a command that wraps around the end of the ring is copied, so nothing is allocated per write.
+//A command that starts with BLE_FRAME_MAGIC is a binary frame, it ends after its length and not at \r\n
+#define BLE_RX_MASK (BLE_RX_BUFFER_SIZE - 1)
+
+struct ble_rx_struct {
+  char buffer[BLE_RX_BUFFER_SIZE];
+  char wrapped[BLE_RX_MAX_COMMAND + 1];
+  uint32_t head;//indexes count up and are masked on access
+  uint32_t tail;//start of the oldest command not handed out
+  uint32_t frame;//start of the command that is still coming in
+  char last;
+  bool dropping;//skips everything up to the next \r\n
+  bool binary;//the command coming in is a binary frame
+  uint32_t skip;//bytes left of a dropped binary frame
+};
+
+ble_rx_struct ble_rx;
+ble_rx_stats_struct ble_rx_stats;
+
+void ble_rx_reset() {
+  ble_rx.head = 0;
+  ble_rx.tail = 0;
+  ble_rx.frame = 0;
+  ble_rx.last = 0;
+  ble_rx.dropping = false;
+  ble_rx.binary = false;
+  ble_rx.skip = 0;
+}
+
+uint32_t frameLength(uint32_t start) {
+  return BLE_FRAME_OVERHEAD + (uint8_t)ble_rx.buffer[(start + 3) & BLE_RX_MASK];
+}
+
+void ble_rx_push(const uint8_t *data, uint32_t length) {
+  ble_rx_stats.bytes += length;
+  for (uint32_t i = 0; i < length; i++) {
+    char c = data[i];
+    if (ble_rx.skip) {
+      ble_rx.skip--;
+      continue;
+    }
+    bool end = !ble_rx.binary && ble_rx.last == '\r' && c == '\n';
+    ble_rx.last = c;
+    if (ble_rx.dropping) {
+      ble_rx.dropping = !end;
+      continue;
+    }
+    if (ble_rx.head == ble_rx.frame)
+      ble_rx.binary = (uint8_t)c == BLE_FRAME_MAGIC;
+    if (ble_rx.head - ble_rx.tail == BLE_RX_BUFFER_SIZE) {
+      uint32_t received = ble_rx.head - ble_rx.frame;
+      if (ble_rx.binary && received >= BLE_FRAME_HEADER)
+        ble_rx.skip = frameLength(ble_rx.frame) - received - 1;
+      else
+        ble_rx.dropping = !end;
+      ble_rx.head = ble_rx.frame;
+      ble_rx.binary = false;
+      ble_rx.last = 0;
+      ble_rx_stats.dropped++;
+      continue;
+    }
+    ble_rx.buffer[ble_rx.head++ & BLE_RX_MASK] = c;
+    if (ble_rx.binary) {
+      uint32_t received = ble_rx.head - ble_rx.frame;
+      if (received >= BLE_FRAME_HEADER && received == frameLength(ble_rx.frame)) {
+        ble_rx.frame = ble_rx.head;
+        ble_rx.binary = false;
+        ble_rx.last = 0;
+      }
+    } else if (end) {
+      ble_rx.frame = ble_rx.head;
+    } else if (ble_rx.head - ble_rx.frame - (c == '\r') > BLE_RX_MAX_COMMAND) {
+      ble_rx.head = ble_rx.frame;
+      ble_rx.dropping = true;
+      ble_rx_stats.dropped++;
+    }
+  }
+}
+
+bool ble_rx_next(ble_command_struct *command) {
+  if (ble_rx.tail == ble_rx.frame)return false;
+  uint32_t start = ble_rx.tail & BLE_RX_MASK;
+  if ((uint8_t)ble_rx.buffer[start] == BLE_FRAME_MAGIC) {//not terminated, the byte after it belongs to the next command
+    command->binary = true;
+    command->length = frameLength(ble_rx.tail);
+    if (start + command->length <= BLE_RX_BUFFER_SIZE) {
+      command->text = &ble_rx.buffer[start];
+    } else {
+      uint32_t first = BLE_RX_BUFFER_SIZE - start;
+      memcpy(ble_rx.wrapped, &ble_rx.buffer[start], first);
+      memcpy(&ble_rx.wrapped[first], ble_rx.buffer, command->length - first);
+      command->text = ble_rx.wrapped;
+    }
+    ble_rx.tail += command->length;
+    ble_rx_stats.commands++;
+    return true;
+  }
+  uint32_t end = ble_rx.tail + 1;
+  while (ble_rx.buffer[end & BLE_RX_MASK] != '\n' || ble_rx.buffer[(end - 1) & BLE_RX_MASK] != '\r')end++;
+  command->binary = false;
+  command->length = end - 1 - ble_rx.tail;
+  if (start + command->length < BLE_RX_BUFFER_SIZE) {
+    ble_rx.buffer[start + command->length] = 0;
+    command->text = &ble_rx.buffer[start];
+  } else {
+    uint32_t first = BLE_RX_BUFFER_SIZE - start;
+    memcpy(ble_rx.wrapped, &ble_rx.buffer[start], first);
+    memcpy(&ble_rx.wrapped[first], ble_rx.buffer, command->length - first);
+    ble_rx.wrapped[command->length] = 0;
+    command->text = ble_rx.wrapped;
+  }
+  ble_rx.tail = end + 1;
+  ble_rx_stats.commands++;
+  return true;
+}
+
+ble_rx_stats_struct get_ble_rx_stats() {
+  return ble_rx_stats;
+}
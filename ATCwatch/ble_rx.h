@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Arduino.h"
+
+#define BLE_RX_BUFFER_SIZE 1024//power of two, holds the command that is still coming in and those not handled yet
+#define BLE_RX_MAX_COMMAND 512//longer commands are dropped up to their \r\n
+
+struct ble_command_struct {
+  const char *text;//terminated where the \r was, valid until the next ble_rx call
+  uint32_t length;
+  bool binary;//a whole binary frame from BLE_FRAME_MAGIC to its CRC
+};
+
+struct ble_rx_stats_struct {
+  uint32_t bytes;
+  uint32_t commands;
+  uint32_t dropped;//too long or no room left for them
+};
+
+void ble_rx_reset();
+void ble_rx_push(const uint8_t *data, uint32_t length);
+bool ble_rx_next(ble_command_struct *command);
+ble_rx_stats_struct get_ble_rx_stats();
@@ -0,0 +1,69 @@
+#include "ble_tx.h"
+
+//outgoing messages wait in a ring and are sent as a stream of full notifications, a message is
+//either queued as a whole or dropped so the phone never gets half of one
+#define BLE_TX_MASK (BLE_TX_BUFFER_SIZE - 1)
+
+struct ble_tx_struct {
+  uint8_t buffer[BLE_TX_BUFFER_SIZE];
+  uint32_t head;//indexes count up and are masked on access
+  uint32_t tail;
+};
+
+ble_tx_struct ble_tx;
+ble_tx_stats_struct ble_tx_stats;
+
+void ble_tx_reset() {
+  ble_tx.head = 0;
+  ble_tx.tail = 0;
+}
+
+void copyIn(const uint8_t *data, uint32_t length) {
+  for (uint32_t i = 0; i < length; i++)
+    ble_tx.buffer[ble_tx.head++ & BLE_TX_MASK] = data[i];
+}
+
+bool reserveMessage(uint32_t length) {
+  if (ble_tx_free() < length) {
+    ble_tx_stats.dropped++;
+    return false;
+  }
+  ble_tx_stats.queued++;
+  return true;
+}
+
+bool ble_tx_push(const uint8_t *data, uint32_t length) {
+  if (!reserveMessage(length))return false;
+  copyIn(data, length);
+  return true;
+}
+
+bool ble_tx_push_line(const char *text, uint32_t length) {
+  //the text followed by \r\n
+  if (!reserveMessage(length + 2))return false;
+  copyIn((const uint8_t *)text, length);
+  copyIn((const uint8_t *)"\r\n", 2);
+  return true;
+}
+
+uint32_t ble_tx_peek(uint8_t *packet) {
+  //copies the next notification, returns its length or 0 if nothing waits
+  uint32_t length = ble_tx.head - ble_tx.tail;
+  if (length > BLE_TX_PACKET)length = BLE_TX_PACKET;
+  for (uint32_t i = 0; i < length; i++)
+    packet[i] = ble_tx.buffer[(ble_tx.tail + i) & BLE_TX_MASK];
+  return length;
+}
+
+void ble_tx_pop(uint32_t length) {
+  ble_tx.tail += length;
+  ble_tx_stats.sent++;
+}
+
+uint32_t ble_tx_free() {
+  return BLE_TX_BUFFER_SIZE - (ble_tx.head - ble_tx.tail);
+}
+
+ble_tx_stats_struct get_ble_tx_stats() {
+  return ble_tx_stats;
+}
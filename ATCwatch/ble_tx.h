@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Arduino.h"
+
+#define BLE_TX_BUFFER_SIZE 512//power of two
+#define BLE_TX_PACKET 20//bytes of one notification
+
+struct ble_tx_stats_struct {
+  uint32_t queued;//messages taken in
+  uint32_t sent;//notifications handed to the stack
+  uint32_t dropped;//messages that did not fit into the queue
+};
+
+void ble_tx_reset();
+bool ble_tx_push(const uint8_t *data, uint32_t length);
+bool ble_tx_push_line(const char *text, uint32_t length);
+uint32_t ble_tx_peek(uint8_t *packet);
+void ble_tx_pop(uint32_t length);
+uint32_t ble_tx_free();
+ble_tx_stats_struct get_ble_tx_stats();
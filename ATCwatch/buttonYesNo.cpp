@@ -3,16 +3,16 @@
 #include "Arduino.h"
 #include "display.h"
 
-  int button_start_x = 30;
-  int button_start_y = 50;
-  int button_size_x = 240 -(button_start_x*2);
-  int button_size_y = 240 -(button_start_y*2);
+  uint32_t button_start_x = 30;
+  uint32_t button_start_y = 50;
+  uint32_t button_size_x = 240 -(button_start_x*2);
+  uint32_t button_size_y = 240 -(button_start_y*2);
 
-  int button_yes_start_x = button_start_x+10;
-  int button_yes_start_y = button_start_y+button_size_y-10-30;
+  uint32_t button_yes_start_x = button_start_x+10;
+  uint32_t button_yes_start_y = button_start_y+button_size_y-10-30;
 
-  int button_no_start_x = button_start_x+button_size_x-10-75;
-  int button_no_start_y = button_start_y+button_size_y-10-30;
+  uint32_t button_no_start_x = button_start_x+button_size_x-10-75;
+  uint32_t button_no_start_y = button_start_y+button_size_y-10-30;
 
 void drawYesNoButton(String text) {
   displayRect(button_start_x, button_start_y, button_size_x, button_size_y, 0xCE18);
@@ -30,5 +30,5 @@ int checkYesNoButtonClick(uint32_t x, uint32_t y){
       return 1;
   else if (button_no_start_x <= x && x <= (button_no_start_x + 75) && button_yes_start_y <= y && y <= (button_no_start_y + 30))
       return 2;
-      return 0;
+  return 0;
 }
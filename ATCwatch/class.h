@@ -5,6 +5,7 @@
 
 #define DEFAULT_SLEEP_TIMEOUT 10000
 #define DEFAULT_REFRESH_TIME 40
+#define NO_REFRESH_TIME 0 //main() only runs after invalidate_screen()
 
 class Screen
 {
@@ -49,8 +50,15 @@ class Screen
       return DEFAULT_SLEEP_TIMEOUT;
     }
     
+    //time between main() calls, screens that only change on input or events return NO_REFRESH_TIME
     virtual uint32_t refreshTime()
     {
       return DEFAULT_REFRESH_TIME;
     }
+
+    //12 for screens made of text and icons, a quarter less to send for every pixel
+    virtual uint32_t colorBits()
+    {
+      return 16;
+    }
 };
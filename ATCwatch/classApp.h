@@ -50,6 +50,16 @@ class AppScreen : public TheScreen
 
     }
 
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
+
+    virtual uint32_t colorBits()
+    {
+      return 12;
+    }
+
     virtual void click(touch_data_struct touch_data)
     {
       switch (check_app_click(touch_data.xpos, touch_data.ypos)) {
@@ -0,0 +1,254 @@
+#pragma once
+#include "Arduino.h"
+#include "classScreen.h"
+#include "display.h"
+
+#define MAX_WIDGETS 20
+
+//widgets keep what they show and only draw again when it changed or after invalidate()
+class Widget
+{
+  public:
+    Widget(uint32_t x, uint32_t y)
+    {
+      _x = x;
+      _y = y;
+    }
+
+    virtual void draw()
+    {
+    }
+
+    virtual void invalidate()
+    {
+      _dirty = true;
+    }
+
+    bool update()
+    {
+      if (!_dirty)return false;
+      _dirty = false;
+      draw();
+      return true;
+    }
+
+  protected:
+    uint32_t _x;
+    uint32_t _y;
+    bool _dirty = true;
+};
+
+class LabelWidget : public Widget
+{
+  public:
+    LabelWidget(uint32_t x, uint32_t y, String text, uint16_t color = 0xFFFF, uint16_t bg = 0x0000, uint32_t size = 2) : Widget(x, y)
+    {
+      _text = text;
+      _color = color;
+      _bg = bg;
+      _size = size;
+    }
+
+    virtual void draw()
+    {
+      displayPrintln(_x, _y, _text, _color, _bg, _size);
+    }
+
+  private:
+    String _text;
+    uint16_t _color;
+    uint16_t _bg;
+    uint32_t _size;
+};
+
+class ValueWidget : public Widget
+{
+  public:
+    ValueWidget(uint32_t x, uint32_t y, uint16_t color = 0xFFFF, uint16_t bg = 0x0000, uint32_t size = 2) : Widget(x, y)
+    {
+      _color = color;
+      _bg = bg;
+      _size = size;
+      reset_text_cache(&_cache);
+    }
+
+    void set(String text)
+    {
+      if (_hidden || text != _text) {
+        _text = text;
+        _hidden = false;
+        _dirty = true;
+      }
+    }
+
+    void hide()//for values drawn over something else, that has to be drawn again by the screen
+    {
+      _hidden = true;
+      _text = "";
+      reset_text_cache(&_cache);
+    }
+
+    virtual void invalidate()
+    {
+      Widget::invalidate();
+      reset_text_cache(&_cache);
+    }
+
+    virtual void draw()
+    {
+      if (!_hidden)displayPrintlnCached(_x, _y, _text, &_cache, _color, _bg, _size);
+    }
+
+  private:
+    String _text;
+    text_cache_struct _cache;
+    bool _hidden = false;
+    uint16_t _color;
+    uint16_t _bg;
+    uint32_t _size;
+};
+
+class IconWidget : public Widget
+{
+  public:
+    IconWidget(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *image = NULL) : Widget(x, y)
+    {
+      _w = w;
+      _h = h;
+      _image = image;
+    }
+
+    IconWidget(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *rle) : Widget(x, y)
+    {
+      _w = w;
+      _h = h;
+      _rle = rle;
+    }
+
+    bool set(const uint32_t *image)
+    {
+      if (image == _image)return false;
+      _image = image;
+      _dirty = true;
+      return true;
+    }
+
+    virtual void draw()
+    {
+      if (_rle)
+        displayImageRLE(_x, _y, _w, _h, _rle);
+      else if (_image)
+        displayImageIndexed(_x, _y, _w, _h, _image);
+    }
+
+  private:
+    uint32_t _w;
+    uint32_t _h;
+    const uint32_t *_image = NULL;
+    const uint16_t *_rle = NULL;
+};
+
+class BarWidget : public Widget
+{
+  public:
+    BarWidget(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t max, uint16_t color = 0xFFFF, uint16_t bg = 0x0000) : Widget(x, y)
+    {
+      _w = w;
+      _h = h;
+      _max = max;
+      _color = color;
+      _bg = bg;
+    }
+
+    void set(uint32_t value)
+    {
+      if (value > _max)value = _max;
+      uint32_t fill = (_w * value) / _max;
+      if (fill != _fill) {
+        _fill = fill;
+        _dirty = true;
+      }
+    }
+
+    void setColor(uint16_t color)
+    {
+      if (color != _color) {
+        _color = color;
+        invalidate();
+      }
+    }
+
+    virtual void invalidate()
+    {
+      Widget::invalidate();
+      _drawnFill = -1;
+    }
+
+    virtual void draw()
+    {
+      if (_drawnFill < 0) {
+        if (_fill)displayRect(_x, _y, _fill, _h, _color);
+        if (_fill < _w)displayRect(_x + _fill, _y, _w - _fill, _h, _bg);
+      } else if (_fill > (uint32_t)_drawnFill) {//only the part that changed
+        displayRect(_x + _drawnFill, _y, _fill - _drawnFill, _h, _color);
+      } else if (_fill < (uint32_t)_drawnFill) {
+        displayRect(_x + _fill, _y, _drawnFill - _fill, _h, _bg);
+      }
+      _drawnFill = _fill;
+    }
+
+  private:
+    uint32_t _w;
+    uint32_t _h;
+    uint32_t _max;
+    uint32_t _fill = 0;
+    int32_t _drawnFill = -1;
+    uint16_t _color;
+    uint16_t _bg;
+};
+
+//screens made of widgets set their values in update(), only the widgets that changed are drawn
+class WidgetScreen : public TheScreen
+{
+  public:
+    virtual void pre()
+    {
+      displayRect(0, 0, 240, 240, 0x0000);
+      for (uint32_t i = 0; i < _numWidgets; i++)
+        _widgets[i]->invalidate();
+      update();
+      drawWidgets();
+    }
+
+    virtual void main()
+    {
+      update();
+      drawWidgets();
+    }
+
+    virtual void update()
+    {
+    }
+
+    virtual uint32_t colorBits()
+    {
+      return 12;
+    }
+
+  protected:
+    void add(Widget *widget)
+    {
+      if (_numWidgets < MAX_WIDGETS)
+        _widgets[_numWidgets++] = widget;
+    }
+
+    void drawWidgets()
+    {
+      for (uint32_t i = 0; i < _numWidgets; i++)
+        _widgets[i]->update();
+    }
+
+  private:
+    Widget *_widgets[MAX_WIDGETS];
+    uint32_t _numWidgets = 0;
+};
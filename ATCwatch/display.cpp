@@ -18,190 +18,776 @@
 #define LCD_BUFFER_SIZE 15000
 uint8_t lcd_buffer[LCD_BUFFER_SIZE+4];
 uint32_t widthheigthWindow = 0;
-bool last_uni_char = false;
-unsigned char last_char;
 
 void init_display() {
   initDisplay();
   display_clear();
 }
 
-bool drawChar(uint32_t x, uint32_t y, unsigned char c, uint16_t color, uint16_t bg, uint32_t size) {
-  if (c < 32)return false;
-  if (c >= 127) {
-    if (!last_uni_char) {
-      last_char = c;
-      last_uni_char = true;
-      return false;
-    } else {
-      last_uni_char = false;
-      if (last_char == 0xC3) {    //remap UTF-8 characters to 8-bit encoding
-        switch (c) {
-          case 0x84://Ä
-            c = 0x8E;
-            break;
-          case 0xA4://ä
-            c = 0x84;
-            break;
-          case 0x96://Ö
-            c = 0x99;
-            break;
-          case 0xB6://ö
-            c = 0x94;
-            break;
-          case 0x9C://Ü
-            c = 0x9A;
-            break;
-          case 0xBC://ü
-            c = 0x81;
-            break;
-          case 0x9F://ß
-            c = 0xE1;
-            break;
-
-          case 0x81://Á
-            c = 0xB5;
-            break;
-          case 0xA1://á
-            c = 0xA0;
-            break;
-          case 0x89://É
-            c = 0x90;
-            break;
-          case 0xA9://é
-            c = 0x82;
-            break;
-          case 0x8D://Í
-            c = 0xD6;
-            break;
-          case 0xAD://í
-            c = 0xA1;
-            break;
-          case 0x93://Ó
-            c = 0xE0;
-            break;
-          case 0xB3://ó
-            c = 0xA2;
-            break;
-          case 0x9A://Ú
-            c = 0xE9;
-            break;
-          case 0xBA://ú
-            c = 0xA3;
-            break;
-          case 0x9D://Ý
-            c = 0xED;
-            break;
-          case 0xBD://ý
-            c = 0xEC;
-            break;
-          default:
-            return false;
-            break;
+//draw calls are stored in a display list. Once a full screen rect was drawn the list describes the whole screen
+//and is kept between frames as a scene, operations hidden by newer ones are dropped. A frame then only marks
+//the bands of rows it touched and each of them is rasterized from the scene and sent as one window.
+//When the scene does not fit the list the frame falls back to dirty regions that are completely covered
+//by the operations of this frame. Outside of a frame draw calls are sent right away.
+#define DISPLAY_LIST_OPS 64
+#define DISPLAY_LIST_REGIONS 16
+#define DISPLAY_LIST_GLYPHS 512
+#define DISPLAY_BAND_ROWS ((LCD_BUFFER_SIZE / 2) / (240 * 2))
+#define DISPLAY_BANDS ((240 + DISPLAY_BAND_ROWS - 1) / DISPLAY_BAND_ROWS)
+#define OP_RECT 0
+#define OP_GLYPHS 1
+#define OP_IMAGE 2
+#define OP_IMAGE_RLE 3
+#define OP_IMAGE_INDEXED 4
+
+struct display_op_struct {
+  uint8_t type;
+  uint8_t size;
+  uint8_t count;//glyphs stored in the glyph pool
+  uint16_t x, y, w, h;
+  uint16_t color;
+  uint16_t bg;//same as color for transparent text
+  const void *data;
+};
+
+struct display_region_struct {
+  uint16_t x, y, w, h;
+};
+
+struct display_list_struct {
+  bool frame;
+  bool scene;
+  bool paused;
+  uint8_t num_ops;
+  uint8_t num_regions;
+  uint16_t num_glyphs;
+  display_op_struct ops[DISPLAY_LIST_OPS];
+  display_region_struct regions[DISPLAY_LIST_REGIONS];
+  display_region_struct bands[DISPLAY_BANDS];//h == 0 if the band is clean
+  unsigned char glyphs[DISPLAY_LIST_GLYPHS];
+};
+
+display_list_struct display_list;
+display_list_stats_struct display_list_stats;
+display_list_stats_struct display_list_frame_stats;
+
+//rows of the screen inside the scroll area are written to the memory row the controller shows there,
+//windows that cross the end of the area are split so draw calls keep using screen coordinates
+#define DISPLAY_SCROLL_STEP 40//rows a screen moves per step when it is scrolled in, at most the 80 hidden memory rows
+
+struct display_scroll_struct {
+  uint16_t top;
+  uint16_t rows;
+  uint16_t offset;//memory row of the first row of the area, counted from top
+};
+
+display_scroll_struct display_scroll = {0, DISPLAY_GRAM_ROWS, 0};
+
+uint32_t gramRow(uint32_t y) {
+  if (y < display_scroll.top || y >= display_scroll.top + display_scroll.rows)return y;
+  return display_scroll.top + (y - display_scroll.top + display_scroll.offset) % display_scroll.rows;
+}
+
+uint32_t gramRows(uint32_t y, uint32_t h) {
+  //rows from y on that follow each other in the memory as well
+  uint32_t bottom = display_scroll.top + display_scroll.rows;
+  if (y < display_scroll.top)
+    return y + h > display_scroll.top ? display_scroll.top - y : h;
+  if (y >= bottom)return h;
+  uint32_t rows = display_scroll.rows - (y - display_scroll.top + display_scroll.offset) % display_scroll.rows;
+  if (rows > bottom - y)rows = bottom - y;
+  return h > rows ? rows : h;
+}
+
+uint8_t display_color_bits = 16;//12 sends two pixels in three bytes, all pixels are drawn as 16 bit first
+
+uint32_t packPixels(uint8_t *buffer, uint32_t pixels) {
+  //RGB565 in display byte order to RGB444 in place, returns the bytes to send
+  uint8_t *out = buffer;
+  for (uint32_t i = 0; i < pixels; i += 2) {
+    uint16_t a = buffer[i * 2] << 8 | buffer[i * 2 + 1];
+    uint16_t b = i + 1 < pixels ? buffer[i * 2 + 2] << 8 | buffer[i * 2 + 3] : 0;
+    *out++ = (a >> 12) << 4 | ((a >> 7) & 0x0F);
+    *out++ = ((a >> 1) & 0x0F) << 4 | (b >> 12);
+    *out++ = ((b >> 7) & 0x0F) << 4 | ((b >> 1) & 0x0F);
+  }
+  return (pixels * 3 + 1) / 2;
+}
+
+//scaled glyphs are expanded once into cells holding their 8 font lines of 6 * size pixels in display byte order,
+//kept in a fixed arena until the least recently used ones make room. Drawing them again is a memcpy per row.
+//The rows of a line are not stored size times. The arena holds what the home screen shows: the 10 digits and ':'
+//of the clock at size 5, the at most 8 glyphs of a date at size 3 and 20 glyphs of the status rows at size 2
+#define GLYPH_BYTES(size) (6 * (size) * 8 * 2)
+#define GLYPH_CACHE_BYTES (11 * GLYPH_BYTES(5) + 8 * GLYPH_BYTES(3) + 20 * GLYPH_BYTES(2))
+#define GLYPH_CACHE_CELLS (11 + 8 + 20)
+#define GLYPH_CACHE_MIN_SIZE 2//smaller glyphs are cheaper to expand than to look up
+
+struct glyph_cell_struct {
+  unsigned char glyph;
+  uint8_t size;
+  uint16_t color;
+  uint16_t bg;
+  uint16_t offset;
+  uint16_t bytes;//0 if the cell is free
+  uint32_t used;
+};
+
+uint8_t glyph_arena[GLYPH_CACHE_BYTES];
+glyph_cell_struct glyph_cells[GLYPH_CACHE_CELLS];
+uint32_t glyph_cache_clock = 0;
+glyph_cache_stats_struct glyph_cache_stats;
+
+int32_t findGlyphSpace(uint32_t bytes) {
+  //first gap between the cells in use that fits, -1 if there is none
+  uint32_t start = 0;
+  while (start + bytes <= GLYPH_CACHE_BYTES) {
+    uint32_t next = start;
+    for (uint32_t i = 0; i < GLYPH_CACHE_CELLS; i++) {
+      glyph_cell_struct *cell = &glyph_cells[i];
+      if (cell->bytes && cell->offset < start + bytes && cell->offset + cell->bytes > start && cell->offset + cell->bytes > next)
+        next = cell->offset + cell->bytes;
+    }
+    if (next == start)return start;
+    start = next;
+  }
+  return -1;
+}
+
+bool glyphCacheable(uint32_t size) {
+  return size >= GLYPH_CACHE_MIN_SIZE && GLYPH_BYTES(size) <= GLYPH_CACHE_BYTES;
+}
+
+const uint8_t *cachedGlyph(unsigned char c, uint32_t size, uint16_t color, uint16_t bg) {
+  //returns the expanded font lines of the glyph, NULL if it is not cached at this size
+  uint32_t w = 6 * size;
+  uint32_t bytes = GLYPH_BYTES(size);
+  if (!glyphCacheable(size))return NULL;
+  glyph_cell_struct *cell = NULL;
+  for (uint32_t i = 0; i < GLYPH_CACHE_CELLS; i++) {
+    glyph_cell_struct *entry = &glyph_cells[i];
+    if (!entry->bytes) {
+      cell = entry;
+    } else if (entry->glyph == c && entry->size == size && entry->color == color && entry->bg == bg) {
+      entry->used = ++glyph_cache_clock;
+      glyph_cache_stats.hits++;
+      return &glyph_arena[entry->offset];
+    }
+  }
+  glyph_cache_stats.misses++;
+  int32_t offset = findGlyphSpace(bytes);
+  while (!cell || offset < 0) {
+    glyph_cell_struct *oldest = NULL;
+    for (uint32_t i = 0; i < GLYPH_CACHE_CELLS; i++) {
+      if (glyph_cells[i].bytes && (!oldest || glyph_cells[i].used < oldest->used))
+        oldest = &glyph_cells[i];
+    }
+    oldest->bytes = 0;
+    cell = oldest;
+    glyph_cache_stats.evictions++;
+    offset = findGlyphSpace(bytes);
+  }
+  cell->glyph = c;
+  cell->size = size;
+  cell->color = color;
+  cell->bg = bg;
+  cell->offset = offset;
+  cell->bytes = bytes;
+  cell->used = ++glyph_cache_clock;
+  uint8_t *pixel = &glyph_arena[offset];
+  for (uint32_t j = 0; j < 8; j++) {
+    for (uint32_t k = 0; k < w; k++) {
+      uint32_t i = k / size;
+      uint16_t color565 = (i < 5 && (font57[c * 5 + i] >> j) & 1) ? color : bg;
+      *pixel++ = color565 >> 8;
+      *pixel++ = color565;
+    }
+  }
+  return &glyph_arena[offset];
+}
+
+glyph_cache_stats_struct get_glyph_cache_stats() {
+  return glyph_cache_stats;
+}
+
+bool rasterCachedGlyphs(const display_op_struct *op, uint8_t *buffer, uint32_t bx, uint32_t by, uint32_t bw, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+  //copies the rows of the cached cells, false if the glyphs are expanded pixel by pixel
+  if (op->color == op->bg || !glyphCacheable(op->size))return false;
+  const unsigned char *glyphs = (const unsigned char *)op->data;
+  uint32_t cellW = 6 * op->size;
+  for (uint32_t g = (x0 - op->x) / cellW; g * cellW + op->x < x1; g++) {
+    const uint8_t *cell = cachedGlyph(glyphs[g], op->size, op->color, op->bg);
+    uint32_t cx0 = op->x + g * cellW > x0 ? op->x + g * cellW : x0;
+    uint32_t cx1 = op->x + (g + 1) * cellW < x1 ? op->x + (g + 1) * cellW : x1;
+    for (uint32_t y = y0; y < y1; y++)
+      memcpy(&buffer[((y - by) * bw + (cx0 - bx)) * 2], &cell[((y - op->y) / op->size * cellW + (cx0 - op->x - g * cellW)) * 2], (cx1 - cx0) * 2);
+  }
+  return true;
+}
+
+void rasterOp(const display_op_struct *op, uint8_t *buffer, uint32_t bx, uint32_t by, uint32_t bw, uint32_t bh) {
+  uint32_t x0 = op->x > bx ? op->x : bx;
+  uint32_t y0 = op->y > by ? op->y : by;
+  uint32_t x1 = op->x + op->w < bx + bw ? op->x + op->w : bx + bw;
+  uint32_t y1 = op->y + op->h < by + bh ? op->y + op->h : by + bh;
+  if (x0 >= x1 || y0 >= y1)return;
+  if (op->type == OP_GLYPHS && rasterCachedGlyphs(op, buffer, bx, by, bw, x0, y0, x1, y1))return;
+  for (uint32_t y = y0; y < y1; y++) {
+    uint8_t *pixel = &buffer[((y - by) * bw + (x0 - bx)) * 2];
+    uint32_t ry = y - op->y;
+    switch (op->type) {
+      case OP_RECT:
+        for (uint32_t x = x0; x < x1; x++) {
+          *pixel++ = op->color >> 8;
+          *pixel++ = op->color;
         }
-      } else if (last_char == 0xC4) {
-        switch (c) {
-          case 0x8C://Č
-            c = 0x80;
-            break;
-          case 0x8D://č
-            c = 0x87;
-            break;
-          case 0x8E://Ď
-            c = 0x9D;
-            break;
-          case 0x8F://ď
-            c = 0x9B;
-            break;
-          case 0x9A://Ě
-            c = 0xD2;
-            break;
-          case 0x9B://ě
-            c = 0x88;
-            break;
-          default:
-            return false;
-            break;
+        break;
+      case OP_GLYPHS: {
+          const unsigned char *glyphs = (const unsigned char *)op->data;
+          uint32_t j = ry / op->size;
+          for (uint32_t x = x0; x < x1; x++, pixel += 2) {
+            uint32_t rx = x - op->x;
+            uint32_t i = (rx / op->size) % 6;
+            uint16_t color;
+            if (i < 5 && (font57[glyphs[rx / (6 * op->size)] * 5 + i] >> j) & 1)
+              color = op->color;
+            else if (op->bg != op->color)
+              color = op->bg;
+            else
+              continue;//transparent text keeps what is below
+            pixel[0] = color >> 8;
+            pixel[1] = color;
+          }
         }
-      } else if (last_char == 0xC5) {
-        switch (c) {
-          case 0xAE://Ů
-            c = 0xEA;
-            break;
-          case 0xAF://ů
-            c = 0x96;
-            break;
-          case 0x87://Ň
-            c = 0xA5;
-            break;
-          case 0x88://ň
-            c = 0xA4;
-            break;
-          case 0x98://Ř
-            c = 0x92;
-            break;
-          case 0x99://ř
-            c = 0x91;
-            break;
-          case 0xA0://Š
-            c = 0xB6;
-            break;
-          case 0xA1://š
-            c = 0x83;
-            break;
-          case 0xA4://Ť
-            c = 0xD7;
-            break;
-          case 0xA5://ť
-            c = 0x8C;
-            break;
-          case 0xBD://Ž
-            c = 0xE2;
-            break;
-          case 0xBE://ž
-            c = 0x93;
-            break;
-          default:
-            return false;
-            break;
+        break;
+      case OP_IMAGE://stored in display byte order
+        memcpy(pixel, (const uint16_t *)op->data + ry * op->w + (x0 - op->x), (x1 - x0) * 2);
+        break;
+      case OP_IMAGE_RLE: {
+          const uint16_t *rle = (const uint16_t *)op->data;
+          uint32_t runStart = 0;
+          uint32_t target = ry * op->w + (x0 - op->x);
+          while (runStart + rle[0] <= target) {
+            runStart += rle[0];
+            rle += 2;
+          }
+          for (uint32_t x = x0; x < x1; x++, target++) {
+            if (target >= runStart + rle[0]) {
+              runStart += rle[0];
+              rle += 2;
+            }
+            *pixel++ = rle[1];
+            *pixel++ = rle[1] >> 8;
+          }
         }
-      } else if (last_char == 0xF0 && c == 0x9F)
-        c = 0x02;
+        break;
+      case OP_IMAGE_INDEXED: {
+          const uint32_t *image = (const uint32_t *)op->data;
+          uint32_t bpp = image[0] & 0xFF;
+          uint32_t colors = (image[0] >> 8) & 0xFF;
+          const uint32_t *pixels = &image[1 + (colors + 1) / 2];
+          uint32_t bit = (ry * op->w + (x0 - op->x)) * bpp;
+          for (uint32_t x = x0; x < x1; x++, bit += bpp) {
+            uint32_t index = (pixels[bit / 32] >> (bit % 32)) & ((1 << bpp) - 1);
+            uint16_t color = image[1 + index / 2] >> ((index & 1) * 16);
+            *pixel++ = color;
+            *pixel++ = color >> 8;
+          }
+        }
+        break;
+    }
+  }
+}
+
+void rasterRegion(const display_region_struct *region, const display_op_struct *ops, uint32_t num_ops) {
+  startWrite();
+  uint32_t rows = (LCD_BUFFER_SIZE / 2) / (region->w * 2);
+  if (display_color_bits == 12 && rows > 1)rows &= ~1;//pixel pairs must not be split between two parts
+  uint8_t *curBuffer = lcd_buffer;
+  for (uint32_t windowY = region->y; windowY < region->y + region->h;) {
+    uint32_t windowRows = gramRows(windowY, region->y + region->h - windowY);
+    setAddrWindowDisplay(region->x, windowY, region->w, windowRows);
+    for (uint32_t y = windowY; y < windowY + windowRows; y += rows) {//fill one half of lcd_buffer while the other one is sent out
+      uint32_t curRows = windowY + windowRows - y;
+      if (curRows > rows)curRows = rows;
+      for (uint32_t i = 0; i < num_ops; i++)
+        rasterOp(&ops[i], curBuffer, region->x, y, region->w, curRows);
+      if (display_color_bits == 12)
+        write_fast_spi_async(curBuffer, packPixels(curBuffer, region->w * curRows));
       else
-        return false;
+        write_fast_spi_async(curBuffer, region->w * curRows * 2);
+      if (curBuffer == lcd_buffer)
+        curBuffer = &lcd_buffer[LCD_BUFFER_SIZE / 2];
+      else
+        curBuffer = lcd_buffer;
+    }
+    windowY += windowRows;
+  }
+  endWrite();
+  display_list_stats.regions++;
+}
+
+void clearDisplayList() {
+  display_list.num_ops = 0;
+  display_list.num_regions = 0;
+  display_list.num_glyphs = 0;
+}
+
+void flush_display_list() {
+  if (display_list.scene) {
+    for (uint32_t i = 0; i < DISPLAY_BANDS; i++) {
+      if (display_list.bands[i].h) {
+        rasterRegion(&display_list.bands[i], display_list.ops, display_list.num_ops);
+        display_list.bands[i].h = 0;
+      }
+    }
+  } else {
+    for (uint32_t i = 0; i < display_list.num_regions; i++)
+      rasterRegion(&display_list.regions[i], display_list.ops, display_list.num_ops);
+    clearDisplayList();
+  }
+}
+
+bool containsRegion(const display_region_struct *a, const display_region_struct *b) {
+  return b->x >= a->x && b->y >= a->y && b->x + b->w <= a->x + a->w && b->y + b->h <= a->y + a->h;
+}
+
+bool intersectsRegion(const display_region_struct *a, const display_region_struct *b) {
+  return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+void addDirtyRegion(display_region_struct region) {
+  //regions are only merged when the result is still completely covered by recorded operations,
+  //pixels outside of them are not known and can not be sent again
+  uint32_t i = 0;
+  while (i < display_list.num_regions) {
+    display_region_struct *other = &display_list.regions[i];
+    bool merge = false;
+    if (containsRegion(other, &region)) {
+      display_list_stats.merged++;
+      return;
+    }
+    if (containsRegion(&region, other)) {
+      merge = true;
+    } else if (other->y == region.y && other->h == region.h && other->x <= region.x + region.w && region.x <= other->x + other->w) {
+      merge = true;
+    } else if (other->x == region.x && other->w == region.w && other->y <= region.y + region.h && region.y <= other->y + other->h) {
+      merge = true;
+    }
+    if (merge) {
+      uint16_t x1 = region.x + region.w > other->x + other->w ? region.x + region.w : other->x + other->w;
+      uint16_t y1 = region.y + region.h > other->y + other->h ? region.y + region.h : other->y + other->h;
+      if (other->x < region.x)region.x = other->x;
+      if (other->y < region.y)region.y = other->y;
+      region.w = x1 - region.x;
+      region.h = y1 - region.y;
+      display_list.regions[i] = display_list.regions[--display_list.num_regions];
+      display_list_stats.merged++;
+      i = 0;//the bigger region may merge with one that was checked already
+    } else {
+      i++;
+    }
+  }
+  display_list.regions[display_list.num_regions++] = region;
+}
+
+void addDirtyBands(display_region_struct region) {
+  if (region.x >= 240 || region.y >= 240)return;
+  uint16_t x1 = region.x + region.w > 240 ? 240 : region.x + region.w;
+  uint16_t y1 = region.y + region.h > 240 ? 240 : region.y + region.h;
+  for (uint32_t i = region.y / DISPLAY_BAND_ROWS; i <= (uint32_t)(y1 - 1) / DISPLAY_BAND_ROWS; i++) {
+    display_region_struct *band = &display_list.bands[i];
+    uint16_t bandY0 = region.y > i * DISPLAY_BAND_ROWS ? region.y : i * DISPLAY_BAND_ROWS;
+    uint16_t bandY1 = y1 < (i + 1) * DISPLAY_BAND_ROWS ? y1 : (i + 1) * DISPLAY_BAND_ROWS;
+    if (!band->h) {
+      band->x = region.x;
+      band->y = bandY0;
+      band->w = x1 - region.x;
+      band->h = bandY1 - bandY0;
+      continue;
+    }
+    display_list_stats.merged++;
+    uint16_t bandX1 = band->x + band->w > x1 ? band->x + band->w : x1;
+    if (bandY1 < band->y + band->h)bandY1 = band->y + band->h;
+    if (band->x < region.x)region.x = band->x;
+    if (band->y < bandY0)bandY0 = band->y;
+    band->x = region.x;
+    band->y = bandY0;
+    band->w = bandX1 - region.x;
+    band->h = bandY1 - bandY0;
+  }
+}
+
+void removeCoveredOps(const display_region_struct *region) {
+  //drops everything an opaque operation draws over and packs the glyph pool again
+  uint32_t num_ops = 0;
+  uint32_t num_glyphs = 0;
+  for (uint32_t i = 0; i < display_list.num_ops; i++) {
+    display_op_struct *op = &display_list.ops[i];
+    display_region_struct opRegion = {op->x, op->y, op->w, op->h};
+    if (containsRegion(region, &opRegion))continue;
+    if (op->type == OP_GLYPHS) {
+      memmove(&display_list.glyphs[num_glyphs], op->data, op->count);
+      op->data = &display_list.glyphs[num_glyphs];
+      num_glyphs += op->count;
     }
+    display_list.ops[num_ops++] = *op;
+  }
+  display_list.num_ops = num_ops;
+  display_list.num_glyphs = num_glyphs;
+}
+
+bool patchGlyphOp(const display_region_struct *region, const unsigned char *glyphs, uint32_t count, uint16_t color, uint16_t bg, uint32_t size) {
+  //text that changes in place, like the digits of a clock, is written into the operation that drew the line
+  for (int32_t i = display_list.num_ops - 1; i >= 0; i--) {
+    display_op_struct *op = &display_list.ops[i];
+    display_region_struct opRegion = {op->x, op->y, op->w, op->h};
+    if (!intersectsRegion(region, &opRegion))continue;
+    if (op->type != OP_GLYPHS || op->y != region->y || op->h != region->h || op->size != size || op->color != color || op->bg != bg)
+      return false;
+    if (!containsRegion(&opRegion, region) || (region->x - op->x) % (6 * size))
+      return false;
+    uint32_t cell = (region->x - op->x) / (6 * size);
+    if (cell + count > op->count)count = op->count - cell;
+    memcpy((unsigned char *)op->data + cell, glyphs, count);
+    return true;
+  }
+  return false;
+}
+
+bool storeDisplayOp(uint8_t type, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color, uint16_t bg, uint32_t size, const void *data, uint32_t count) {
+  //returns true if the operation is drawn later
+  bool fullScreen = type == OP_RECT && x == 0 && y == 0 && w >= 240 && h >= 240;
+  if (display_list.paused || (!display_list.frame && !display_list.scene && !fullScreen))return false;
+  if (!w || !h)return display_list.frame;
+  display_list_stats.ops++;
+  bool opaque = type != OP_GLYPHS || color != bg;
+  display_region_struct region = {(uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h};
+  if (fullScreen) {//everything below is hidden, the scene starts again
+    clearDisplayList();
+    display_list.scene = true;
+  }
+  if (display_list.scene) {
+    if (opaque)removeCoveredOps(&region);
+    if (type == OP_GLYPHS && opaque && patchGlyphOp(&region, (const unsigned char *)data, count, color, bg, size)) {
+      display_list_stats.merged++;
+      if (display_list.frame)addDirtyBands(region);
+      return display_list.frame;
+    }
+    if (display_list.num_ops == DISPLAY_LIST_OPS || display_list.num_glyphs + count > DISPLAY_LIST_GLYPHS) {
+      if (display_list.frame)flush_display_list();
+      display_list.scene = false;
+      clearDisplayList();
+      if (!display_list.frame || !opaque)return false;
+    }
+  } else if (display_list.num_ops == DISPLAY_LIST_OPS || display_list.num_regions == DISPLAY_LIST_REGIONS || display_list.num_glyphs + count > DISPLAY_LIST_GLYPHS) {
+    flush_display_list();
+  }
+  display_op_struct *op = &display_list.ops[display_list.num_ops++];
+  op->type = type;
+  op->size = size;
+  op->count = count;
+  op->x = x;
+  op->y = y;
+  op->w = w;
+  op->h = h;
+  op->color = color;
+  op->bg = bg;
+  op->data = data;
+  if (type == OP_GLYPHS) {//the glyphs are copied, callers pass buffers on their stack
+    op->data = &display_list.glyphs[display_list.num_glyphs];
+    memcpy(&display_list.glyphs[display_list.num_glyphs], data, count);
+    display_list.num_glyphs += count;
   }
+  if (!display_list.frame)return false;
+  if (display_list.scene)
+    addDirtyBands(region);
+  else
+    addDirtyRegion(region);
+  return true;
+}
+
+bool recordDisplayOp(uint8_t type, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color, uint16_t bg, uint32_t size, const void *data, uint32_t count = 0) {
+  //returns true if the operation is drawn later or was drawn already, otherwise the caller draws it right away
+  if (storeDisplayOp(type, x, y, w, h, color, bg, size, data, count))return true;
+  if (!w || !h || (type == OP_GLYPHS && color == bg))return false;
+  if (gramRows(y, h) >= h && (display_color_bits == 16 || type == OP_RECT))return false;
+  display_op_struct op = {type, (uint8_t)size, (uint8_t)count, (uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, color, bg, data};
+  display_region_struct region = {(uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h};
+  rasterRegion(&region, &op, 1);//the window crosses the end of the scroll area or the pixels get packed
+  return true;
+}
+
+void begin_display_frame() {
+  memset(&display_list_stats, 0, sizeof(display_list_stats));
+  display_list.frame = true;
+}
+
+void end_display_frame() {
+  flush_display_list();
+  display_list.frame = false;
+  display_list_frame_stats = display_list_stats;
+}
+
+display_list_stats_struct get_display_list_stats() {
+  return display_list_frame_stats;
+}
+
+void showScrollOffset(uint32_t offset) {
+  uint8_t temp[2];
+  uint32_t start = display_scroll.top + offset;
+  startWrite();
+  spiCommand(ST77XX_VSCSAD);
+  temp[0] = start >> 8;
+  temp[1] = start;
+  write_fast_spi(temp, 2);
+  endWrite();
+}
+
+void set_display_scroll_area(uint32_t top, uint32_t rows) {
+  //the rows from top on can be scrolled, everything else stays. What is on the screen has to be drawn again
+  uint8_t temp[6];
+  uint32_t bottom = DISPLAY_GRAM_ROWS - top - rows;
+  if (display_list.frame)flush_display_list();
+  display_list.scene = false;
+  clearDisplayList();
+  display_scroll.top = top;
+  display_scroll.rows = rows;
+  display_scroll.offset = 0;
+  startWrite();
+  spiCommand(ST77XX_VSCRDEF);
+  temp[0] = top >> 8;
+  temp[1] = top;
+  temp[2] = rows >> 8;
+  temp[3] = rows;
+  temp[4] = bottom >> 8;
+  temp[5] = bottom;
+  write_fast_spi(temp, 6);
+  endWrite();
+  showScrollOffset(0);
+}
+
+void scroll_display(int32_t rows) {
+  //moves the scroll area up by rows or down if negative, the caller draws the rows that came in
+  if (display_list.frame)flush_display_list();
+  display_list.scene = false;//the scene does not know where its pixels went
+  clearDisplayList();
+  display_scroll.offset = (display_scroll.offset + display_scroll.rows + rows % display_scroll.rows) % display_scroll.rows;
+  showScrollOffset(display_scroll.offset);
+}
+
+void scroll_display_frame(bool up) {
+  //ends the frame by moving the old screen out and the scene in, the rows that come in are filled while still hidden
+  if (!display_list.scene || display_scroll.top || display_scroll.rows != DISPLAY_GRAM_ROWS) {
+    end_display_frame();
+    return;
+  }
+  uint32_t from = display_scroll.offset;
+  display_scroll.offset = (from + (up ? 240 : DISPLAY_GRAM_ROWS - 240)) % DISPLAY_GRAM_ROWS;
+  for (uint32_t s = 0; s < 240; s += DISPLAY_SCROLL_STEP) {
+    display_region_struct region = {0, (uint16_t)(up ? s : 240 - s - DISPLAY_SCROLL_STEP), 240, DISPLAY_SCROLL_STEP};
+    rasterRegion(&region, display_list.ops, display_list.num_ops);
+    showScrollOffset((from + (up ? s + DISPLAY_SCROLL_STEP : DISPLAY_GRAM_ROWS - s - DISPLAY_SCROLL_STEP)) % DISPLAY_GRAM_ROWS);
+  }
+  for (uint32_t i = 0; i < DISPLAY_BANDS; i++)
+    display_list.bands[i].h = 0;
+  display_list.frame = false;
+  display_list_frame_stats = display_list_stats;
+}
+
+int16_t decodeCodePoint(uint32_t codePoint) {
+  uint8_t glyph = 0;
+  if (codePoint >= 0xA0 && codePoint <= 0xFF)
+    glyph = utf8_latin1[codePoint - 0xA0];
+  else if (codePoint >= 0x100 && codePoint <= 0x17F)
+    glyph = utf8_latin_ext_a[codePoint - 0x100];
+  else if (codePoint >= 0x2C7 && codePoint <= 0x2DD)
+    glyph = utf8_spacing_accents[codePoint - 0x2C7];
+  else if (codePoint >= 0x1F000 && codePoint <= 0x1FFFF)//emojis are all drawn as a smiley
+    glyph = 0x02;
+  if (!glyph)return -1;
+  return glyph;
+}
+
+int16_t decodeUtf8(const unsigned char *text, uint32_t len, uint32_t *used) {
+  //decodes the UTF-8 sequence at text without any state kept between calls, a broken sequence only costs its first byte
+  unsigned char c = text[0];
+  *used = 1;
+  if (c < 0x80) {
+    if (c < 32 || c == 127)return -1;
+    return c;
+  }
+  uint32_t codePoint;
+  uint32_t count;
+  uint32_t minimum;
+  if ((c & 0xE0) == 0xC0) {
+    codePoint = c & 0x1F;
+    count = 1;
+    minimum = 0x80;
+  } else if ((c & 0xF0) == 0xE0) {
+    codePoint = c & 0x0F;
+    count = 2;
+    minimum = 0x800;
+  } else if ((c & 0xF8) == 0xF0) {
+    codePoint = c & 0x07;
+    count = 3;
+    minimum = 0x10000;
+  } else {
+    return -1;
+  }
+  if (count >= len)return -1;
+  for (uint32_t i = 1; i <= count; i++) {
+    if ((text[i] & 0xC0) != 0x80)return -1;
+    codePoint = (codePoint << 6) | (text[i] & 0x3F);
+  }
+  *used = count + 1;
+  if (codePoint < minimum)return -1;
+  return decodeCodePoint(codePoint);
+}
+
+void drawChar(uint32_t x, uint32_t y, unsigned char c, uint16_t color, uint16_t bg, uint32_t size) {
+  if (bg != color) {
+    displayGlyphs(x, y, &c, 1, color, bg, size);
+    return;
+  }
+  if (display_list.scene && recordDisplayOp(OP_GLYPHS, x, y, 5 * size, 8 * size, color, bg, size, &c, 1))
+    return;//composited over what the scene has below it
+  if (display_list.frame)flush_display_list();//without a scene the pixels below are not known, draw them right away
+  bool paused = display_list.paused;
+  display_list.paused = true;
   for (int8_t i = 0; i < 5; i++) {
     uint8_t line = font57[c * 5 + i];
     for (int8_t j = 0; j < 8; j++, line >>= 1) {
       if (line & 1) {
         displayRect(x + i * size, y + j * size, size, size, color);
-      } else if (bg != color) {
-        displayRect(x + i * size, y + j * size, size, size, bg);
       }
     }
   }
-  if (bg != color) {
-    displayRect(x + 5 * size, y, size, 8 * size, bg);
+  display_list.paused = paused;
+}
+
+void displayGlyphs(uint32_t x, uint32_t y, const unsigned char *glyphs, uint32_t count, uint16_t color, uint16_t bg, uint32_t size) {
+  uint32_t width = count * 6 * size;
+  uint32_t height = 8 * size;
+  if (x < 240 && x + width > 240)width = 240 - x;
+  if (recordDisplayOp(OP_GLYPHS, x, y, width, height, color, bg, size, glyphs, count))return;
+  uint32_t rowSize = width * 2;
+  startWrite();
+  setAddrWindowDisplay(x, y, width, height);
+  if (glyphCacheable(size)) {//the rows are copied from the cached cells, as many as fit into lcd_buffer at once
+    uint32_t cellW = 6 * size;
+    uint32_t rows = LCD_BUFFER_SIZE / rowSize;
+    for (uint32_t r0 = 0; r0 < height; r0 += rows) {
+      uint32_t r1 = r0 + rows < height ? r0 + rows : height;
+      for (uint32_t g = 0; g * cellW < width; g++) {
+        const uint8_t *cell = cachedGlyph(glyphs[g], size, color, bg);
+        uint32_t cw = width - g * cellW < cellW ? width - g * cellW : cellW;
+        for (uint32_t r = r0; r < r1; r++)
+          memcpy(&lcd_buffer[(r - r0) * rowSize + g * cellW * 2], &cell[(r / size) * cellW * 2], cw * 2);
+      }
+      write_fast_spi(lcd_buffer, (r1 - r0) * rowSize);
+    }
+    endWrite();
+    return;
   }
-  return true;
+  uint32_t bufferPos = 0;
+  for (uint32_t r = 0; r < height; r++) {
+    uint8_t *row = &lcd_buffer[bufferPos];
+    if (r % size == 0 || bufferPos == 0) {
+      uint32_t j = r / size;
+      for (uint32_t k = 0; k < width; k++) {
+        uint32_t i = (k / size) % 6;
+        uint16_t pixel = (i < 5 && (font57[glyphs[k / (6 * size)] * 5 + i] >> j) & 1) ? color : bg;
+        row[k * 2] = pixel >> 8;
+        row[k * 2 + 1] = pixel;
+      }
+    } else {
+      memcpy(row, row - rowSize, rowSize);
+    }
+    bufferPos += rowSize;
+    if (bufferPos + rowSize > LCD_BUFFER_SIZE || r == height - 1) {
+      write_fast_spi(lcd_buffer, bufferPos);
+      bufferPos = 0;
+    }
+  }
+  endWrite();
 }
 
 void displayPrintln(uint32_t x, uint32_t y, String text, uint16_t color, uint16_t bg, uint32_t size) {
-  int tempPosition = 0;
-  for (int f = 0; f < text.length(); f++)
+  const unsigned char *chars = (const unsigned char *)text.c_str();
+  uint32_t len = text.length();
+  uint32_t used;
+  if (bg == color) {//transparent text can only be drawn pixel by pixel
+    int tempPosition = 0;
+    for (uint32_t f = 0; f < len; f += used)
+    {
+      int16_t glyph = decodeUtf8(&chars[f], len - f, &used);
+      if (glyph < 0)continue;
+      if (x + (tempPosition * 6 * size) >= 234) {
+        x = -(tempPosition * 6 * size);
+        y += (8 * size);
+      }
+      drawChar(x + (tempPosition * 6 * size), y, glyph, color, bg, size);
+      tempPosition++;
+    }
+    return;
+  }
+  unsigned char glyphs[40];
+  uint32_t count = 0;
+  for (uint32_t f = 0; f < len; f += used)
   {
-    if (x + (tempPosition * 6 * size) >= 234) {
-      x = -(tempPosition * 6 * size);
+    int16_t glyph = decodeUtf8(&chars[f], len - f, &used);
+    if (glyph < 0)continue;
+    if (x + (count * 6 * size) >= 234 || count == sizeof(glyphs)) {
+      if (count)displayGlyphs(x, y, glyphs, count, color, bg, size);
+      count = 0;
+      x = 0;
       y += (8 * size);
     }
-    if (drawChar(x + (tempPosition * 6 * size), y, text[f], color, bg, size)) {
-      tempPosition++;
+    glyphs[count++] = glyph;
+  }
+  if (count)displayGlyphs(x, y, glyphs, count, color, bg, size);
+}
+
+void displayPrintlnCached(uint32_t x, uint32_t y, String text, text_cache_struct *cache, uint16_t color, uint16_t bg, uint32_t size) {
+  //keeps the text on one line and only draws the glyph cells that changed since the last call with this cache
+  const unsigned char *chars = (const unsigned char *)text.c_str();
+  uint32_t len = text.length();
+  uint32_t used;
+  unsigned char glyphs[sizeof(cache->glyphs)];
+  uint32_t count = 0;
+  for (uint32_t f = 0; f < len && count < sizeof(glyphs) && x + ((count + 1) * 6 * size) <= 240; f += used)
+  {
+    int16_t glyph = decodeUtf8(&chars[f], len - f, &used);
+    if (glyph < 0)continue;
+    glyphs[count++] = glyph;
+  }
+  uint32_t lastCount = cache->count;
+  if (color != cache->color || bg != cache->bg)lastCount = 0;
+  uint32_t f = 0;
+  while (f < count) {
+    if (f < lastCount && glyphs[f] == cache->glyphs[f]) {
+      f++;
+      continue;
     }
+    uint32_t start = f;
+    while (f < count && (f >= lastCount || glyphs[f] != cache->glyphs[f]))f++;
+    displayGlyphs(x + (start * 6 * size), y, &glyphs[start], f - start, color, bg, size);
   }
+  if (cache->count > count)//clear the cells the longer old text used
+    displayRect(x + (count * 6 * size), y, (cache->count - count) * 6 * size, 8 * size, bg);
+  memcpy(cache->glyphs, glyphs, count);
+  cache->count = count;
+  cache->color = color;
+  cache->bg = bg;
+}
+
+void reset_text_cache(text_cache_struct *cache) {
+  cache->count = 0;
 }
 
 void displayRect(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color) {
+  if (recordDisplayOp(OP_RECT, x, y, w, h, color, color, 1, NULL))return;
   startWrite();
   setAddrWindowDisplay(x, y, w, h);
   displayColor(color);
@@ -209,32 +795,127 @@ void displayRect(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color)
 }
 
 void displayImage(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *buffer) {
+  if (recordDisplayOp(OP_IMAGE, x, y, w, h, 0, 0, 1, buffer))return;
   startWrite();
   setAddrWindowDisplay(x, y, w, h);
   uint32_t numPixels = (widthheigthWindow * 2);
   uint32_t curPosition = 0;
   uint32_t curSize;
-  uint32_t bufferPos;
-  do {
-    memset(lcd_buffer, 0x43, LCD_BUFFER_SIZE);
-    if ((numPixels - curPosition) > LCD_BUFFER_SIZE)
-      curSize = LCD_BUFFER_SIZE;
+  uint8_t *curBuffer = lcd_buffer;
+  do {//copy into one half of lcd_buffer while the other one is sent out, EasyDMA can not read from flash
+    if ((numPixels - curPosition) > (LCD_BUFFER_SIZE / 2))
+      curSize = (LCD_BUFFER_SIZE / 2);
     else
       curSize = (numPixels - curPosition);
 
-    for (int i = 0; i < curSize; i++) {
-      lcd_buffer[i++] = buffer[bufferPos] >> 8;
-      lcd_buffer[i] = buffer[bufferPos];
-      bufferPos++;
-    }
-    write_fast_spi(lcd_buffer, curSize);
+    memcpy(curBuffer, (const uint8_t *)buffer + curPosition, curSize);
+    write_fast_spi_async(curBuffer, curSize);
     curPosition += curSize;
+    if (curBuffer == lcd_buffer)
+      curBuffer = &lcd_buffer[LCD_BUFFER_SIZE / 2];
+    else
+      curBuffer = lcd_buffer;
   } while (curPosition < numPixels);
   endWrite();
 }
 
+void displayImageRLE(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *rle) {
+  if (recordDisplayOp(OP_IMAGE_RLE, x, y, w, h, 0, 0, 1, rle))return;
+  startWrite();
+  setAddrWindowDisplay(x, y, w, h);
+  uint32_t numPixels = widthheigthWindow;
+  uint32_t runLeft = 0;
+  uint16_t runColor;
+  uint8_t *curBuffer = lcd_buffer;
+  do {//rle is a list of (count, color) pairs, expand them into one half of lcd_buffer while the other one is sent out
+    uint32_t curSize = numPixels;
+    if (curSize > (LCD_BUFFER_SIZE / 4))
+      curSize = (LCD_BUFFER_SIZE / 4);
+    uint32_t i = 0;
+    while (i < curSize) {
+      if (!runLeft) {
+        runLeft = *rle++;
+        runColor = *rle++;
+      }
+      uint32_t runEnd = i + runLeft;
+      if (runEnd > curSize)runEnd = curSize;
+      runLeft -= (runEnd - i);
+      for (; i < runEnd; i++) {
+        curBuffer[i * 2] = runColor;
+        curBuffer[i * 2 + 1] = runColor >> 8;
+      }
+    }
+    write_fast_spi_async(curBuffer, curSize * 2);
+    numPixels -= curSize;
+    if (curBuffer == lcd_buffer)
+      curBuffer = &lcd_buffer[LCD_BUFFER_SIZE / 2];
+    else
+      curBuffer = lcd_buffer;
+  } while (numPixels);
+  endWrite();
+}
+
+void displayImageDelta(uint32_t x, uint32_t y, const uint16_t *delta) {
+  //delta is the number of rectangles, then for each x | y << 8, w | h << 8 and its pixels in display byte order.
+  //Only the pixels that changed since the frame before are sent, so the scene can not know the whole image
+  if (display_list.frame)flush_display_list();
+  display_list.scene = false;
+  clearDisplayList();
+  bool paused = display_list.paused;
+  display_list.paused = true;
+  uint32_t count = *delta++;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t rectX = delta[0] & 0xFF;
+    uint32_t rectY = delta[0] >> 8;
+    uint32_t rectW = delta[1] & 0xFF;
+    uint32_t rectH = delta[1] >> 8;
+    displayImage(x + rectX, y + rectY, rectW, rectH, &delta[2]);
+    delta += 2 + rectW * rectH;
+  }
+  display_list.paused = paused;
+}
+
+void displayImageIndexed(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *image) {
+  if (recordDisplayOp(OP_IMAGE_INDEXED, x, y, w, h, 0, 0, 1, image))return;
+  uint32_t bpp = image[0] & 0xFF;
+  uint32_t colors = (image[0] >> 8) & 0xFF;
+  uint32_t mask = (1 << bpp) - 1;
+  uint16_t palette[16];
+  for (uint32_t i = 0; i < colors; i++)//two palette colors per word, low half first
+    palette[i] = image[1 + i / 2] >> ((i & 1) * 16);
+  const uint32_t *pixels = &image[1 + (colors + 1) / 2];
+  startWrite();
+  setAddrWindowDisplay(x, y, w, h);
+  uint32_t numPixels = widthheigthWindow;
+  uint32_t word = 0;
+  uint32_t bitsLeft = 0;
+  uint8_t *curBuffer = lcd_buffer;
+  do {//pixels are packed LSB first without row padding, expand them into one half of lcd_buffer while the other one is sent out
+    uint32_t curSize = numPixels;
+    if (curSize > (LCD_BUFFER_SIZE / 4))
+      curSize = (LCD_BUFFER_SIZE / 4);
+    for (uint32_t i = 0; i < curSize; i++) {
+      if (!bitsLeft) {
+        word = *pixels++;
+        bitsLeft = 32;
+      }
+      uint16_t color = palette[word & mask];
+      word >>= bpp;
+      bitsLeft -= bpp;
+      curBuffer[i * 2] = color;
+      curBuffer[i * 2 + 1] = color >> 8;
+    }
+    write_fast_spi_async(curBuffer, curSize * 2);
+    numPixels -= curSize;
+    if (curBuffer == lcd_buffer)
+      curBuffer = &lcd_buffer[LCD_BUFFER_SIZE / 2];
+    else
+      curBuffer = lcd_buffer;
+  } while (numPixels);
+  endWrite();
+}
+
 void display_enable(bool state) {
-  uint8_t temp[2];
   startWrite();
   if (state) {
     spiCommand(ST77XX_DISPON);
@@ -246,30 +927,80 @@ void display_enable(bool state) {
   endWrite();
 }
 
+void set_display_color_bits(uint32_t bits) {
+  //what is already on the screen stays, only new pixels are sent with the other depth
+  uint8_t temp[1];
+  if (bits == display_color_bits)return;
+  display_color_bits = bits;
+  startWrite();
+  spiCommand(ST77XX_COLMOD);
+  temp[0] = bits == 12 ? 3 : 5;
+  write_fast_spi(temp, 1);
+  endWrite();
+}
+
+uint32_t get_display_color_bits() {
+  return display_color_bits;
+}
+
+void display_idle(bool state, uint32_t top, uint32_t rows) {
+  //only the rows from top on are driven and only in 8 colours, everything else stays black
+  uint8_t temp[4];
+  startWrite();
+  if (state) {
+    spiCommand(ST77XX_PTLAR);
+    temp[0] = top >> 8;
+    temp[1] = top;
+    temp[2] = (top + rows - 1) >> 8;
+    temp[3] = top + rows - 1;
+    write_fast_spi(temp, 4);
+    spiCommand(ST77XX_PTLON);
+    spiCommand(ST77XX_IDMON);
+  } else {
+    spiCommand(ST77XX_IDMOFF);
+    spiCommand(ST77XX_NORON);
+  }
+  endWrite();
+}
+
 void display_clear() {
+  set_display_scroll_area(0, DISPLAY_GRAM_ROWS);
+  if (recordDisplayOp(OP_RECT, 0, 0, 240, 240, 0x0000, 0x0000, 1, NULL))return;
   startWrite();
   setAddrWindowDisplay(0, 0, 240, 240);
   displayColor();
   endWrite();
 }
 
+//D/C can only be toggled by GPIOTE on an END, SPIM has no event per byte that TIMER3 could count, so every
+//command is padded to a whole part with NOPs. The list costs 9 bytes more on the bus than the old setup, about
+//9 us at 8 MHz, and saves 4 DMA starts the CPU waits for and 6 LCD_RS writes. Windows for fewer pixel bytes than
+//DISPLAY_WINDOW_LIST_BYTES have little to prepare meanwhile, the NOPs would be a large part of their bus time
+uint8_t window_commands[5 * SPI_COMMAND_PART] = {//sent by DMA while the caller prepares the pixels
+  ST77XX_NOP, ST77XX_NOP, ST77XX_NOP, ST77XX_CASET, 0, 0, 0, 0,
+  ST77XX_NOP, ST77XX_NOP, ST77XX_NOP, ST77XX_RASET, 0, 0, 0, 0,
+  ST77XX_NOP, ST77XX_NOP, ST77XX_NOP, ST77XX_RAMWR
+};
+
 void setAddrWindowDisplay(uint32_t x, uint32_t y, uint32_t w, uint32_t h)
 {
-  uint8_t temp[4];
+  uint32_t row = gramRow(y);//the rows have to follow each other in the memory, see gramRows()
   widthheigthWindow = w * h;
-  spiCommand(0x2A);
-  temp[0] = 0x00;
-  temp[1] = x;
-  temp[2] = 0x00;
-  temp[3] = (x + w - 1);
-  write_fast_spi(temp, 4);
-  spiCommand(0x2B);
-  temp[0] = 0x00;
-  temp[1] = y;
-  temp[2] = 0x00;
-  temp[3] = ((y + h - 1) & 0xFF);
-  write_fast_spi(temp, 4);
-  spiCommand(0x2C);
+  count_spi_window();
+  wait_fast_spi();
+  window_commands[5] = x;
+  window_commands[7] = x + w - 1;
+  window_commands[12] = row >> 8;
+  window_commands[13] = row;
+  window_commands[14] = (row + h - 1) >> 8;
+  window_commands[15] = row + h - 1;
+  if (w * h * 2 < DISPLAY_WINDOW_LIST_BYTES) {
+    spiCommand(ST77XX_CASET);
+    write_fast_spi(&window_commands[4], 4);
+    spiCommand(ST77XX_RASET);
+    write_fast_spi(&window_commands[12], 4);
+    spiCommand(ST77XX_RAMWR);
+  } else write_fast_spi_commands(window_commands, 5);
 }
 
 void initDisplay() {
@@ -377,6 +1108,7 @@ void initDisplay() {
 }
 
 void spiCommand(uint8_t d) {
+  wait_fast_spi();
   digitalWrite(LCD_RS , LOW);
   write_fast_spi(&d, 1);
   digitalWrite(LCD_RS , HIGH);
@@ -392,26 +1124,50 @@ void startWrite(void) {
 }
 
 void endWrite(void) {
+  wait_fast_spi();
   digitalWrite(LCD_CS , HIGH);
   enable_spi(false);
 }
 
 void displayColor(uint16_t color) {
   uint32_t currentPart;
+  if (display_color_bits == 12) {//the buffer holds whole pixel pairs, LCD_BUFFER_SIZE is a multiple of 3
+    uint32_t currentAll = (widthheigthWindow * 3 + 1) / 2;
+    uint32_t colorSize = LCD_BUFFER_SIZE;
+    if (currentAll < colorSize)colorSize = currentAll;
+    for (uint32_t i = 0; i < colorSize; i += 3) {
+      lcd_buffer[i] = (color >> 12) << 4 | ((color >> 7) & 0x0F);
+      lcd_buffer[i + 1] = ((color >> 1) & 0x0F) << 4 | (color >> 12);
+      lcd_buffer[i + 2] = ((color >> 7) & 0x0F) << 4 | ((color >> 1) & 0x0F);
+    }
+    while (currentAll > 0) {
+      currentPart = currentAll < colorSize ? currentAll : colorSize;
+      write_fast_spi_async(lcd_buffer, currentPart);
+      currentAll -= currentPart;
+    }
+    return;
+  }
   uint32_t currentAll = (widthheigthWindow * 2);
   uint32_t colorSize = LCD_BUFFER_SIZE;
   if (currentAll < colorSize)colorSize = currentAll;
-  for (int i = 0; i <= colorSize; i++) {
+  uint32_t firstPart = 510;
+  if (colorSize < firstPart)firstPart = colorSize;
+  for (uint32_t i = 0; i < firstPart; i++) {
+    lcd_buffer[i++] = color >> 8;
+    lcd_buffer[i] = color;
+  }
+  write_fast_spi_async(lcd_buffer, firstPart);
+  currentAll -= firstPart;
+  for (uint32_t i = firstPart; i <= colorSize; i++) {//fill the rest while the first part is sent
     lcd_buffer[i++] = color >> 8;
     lcd_buffer[i] = color;
   }
-  do
+  while (currentAll > 0)
   {
-    if (currentAll >= LCD_BUFFER_SIZE)currentPart = LCD_BUFFER_SIZE;
+    if (currentAll >= colorSize)currentPart = colorSize;
     else
       currentPart = currentAll;
-    write_fast_spi(lcd_buffer, currentPart);
+    write_fast_spi_async(lcd_buffer, currentPart);
     currentAll -= currentPart;
   }
-  while ( currentAll > 0);
 }
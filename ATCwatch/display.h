@@ -24,9 +24,13 @@
 #define ST77XX_RAMRD 0x2E
 
 #define ST77XX_PTLAR 0x30
+#define ST77XX_VSCRDEF 0x33
 #define ST77XX_TEOFF 0x34
 #define ST77XX_TEON 0x35
 #define ST77XX_MADCTL 0x36
+#define ST77XX_VSCSAD 0x37
+#define ST77XX_IDMOFF 0x38
+#define ST77XX_IDMON 0x39
 #define ST77XX_COLMOD 0x3A
 
 #define ST77XX_MADCTL_MY 0x80
@@ -40,12 +44,53 @@
 #define ST77XX_RDID3 0xDC
 #define ST77XX_RDID4 0xDD
 
+#define DISPLAY_GRAM_ROWS 320//the controller memory has more rows than the screen
+#define DISPLAY_WINDOW_LIST_BYTES 128//pixel bytes from which a window is set up with one DMA list, see setAddrWindowDisplay()
+
+struct text_cache_struct {
+  unsigned char glyphs[40];
+  uint8_t count;
+  uint16_t color;
+  uint16_t bg;
+};
+
+struct display_list_stats_struct {
+  uint32_t ops;
+  uint32_t merged;//operations that fell into an existing dirty region
+  uint32_t regions;//windows sent
+};
+
+struct glyph_cache_stats_struct {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+};
+
 void init_display();
-bool drawChar(uint32_t x, uint32_t y, unsigned char c, uint16_t color, uint16_t bg, uint32_t size);
+void begin_display_frame();
+void end_display_frame();
+void flush_display_list();
+display_list_stats_struct get_display_list_stats();
+glyph_cache_stats_struct get_glyph_cache_stats();
+void set_display_scroll_area(uint32_t top, uint32_t rows);
+void scroll_display(int32_t rows);
+void scroll_display_frame(bool up);
+int16_t decodeCodePoint(uint32_t codePoint);
+int16_t decodeUtf8(const unsigned char *text, uint32_t len, uint32_t *used);
+void drawChar(uint32_t x, uint32_t y, unsigned char c, uint16_t color, uint16_t bg, uint32_t size);
+void displayGlyphs(uint32_t x, uint32_t y, const unsigned char *glyphs, uint32_t count, uint16_t color, uint16_t bg, uint32_t size);
 void displayPrintln(uint32_t x, uint32_t y, String text, uint16_t color = 0xFFFF, uint16_t bg = 0x0000, uint32_t size = 1);
+void displayPrintlnCached(uint32_t x, uint32_t y, String text, text_cache_struct *cache, uint16_t color = 0xFFFF, uint16_t bg = 0x0000, uint32_t size = 1);
+void reset_text_cache(text_cache_struct *cache);
 void displayRect(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color);
 void displayImage(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *buffer);
+void displayImageRLE(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *rle);
+void displayImageIndexed(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint32_t *image);
+void displayImageDelta(uint32_t x, uint32_t y, const uint16_t *delta);
 void display_enable(bool state);
+void set_display_color_bits(uint32_t bits);
+uint32_t get_display_color_bits();
+void display_idle(bool state, uint32_t top = 0, uint32_t rows = 240);
 void display_clear();
 
 void setAddrWindowDisplay(uint32_t x, uint32_t y, uint32_t w, uint32_t h);
@@ -2,6 +2,35 @@
 #include "fast_spi.h"
 #include "pinout.h"
 
+//long transfers are sent as a list of 255 byte EasyDMA parts, restarted by PPI on every END
+//and counted by a timer that cuts the chain after the last part
+#define SPI_LIST_TIMER NRF_TIMER3
+#define SPI_LIST_TIMER_IRQn TIMER3_IRQn
+#define SPI_LIST_PPI_START 9
+#define SPI_LIST_PPI_COUNT 10
+#define SPI_LIST_PPI_STOP 11
+#define SPI_LIST_PPI_GROUP 0
+#define SPI_LIST_CHANNELS ((1U << SPI_LIST_PPI_START) | (1U << SPI_LIST_PPI_COUNT) | (1U << SPI_LIST_PPI_STOP))
+#define SPI_LIST_MIN_LEN (2 * 0xFF)
+
+//commands and their arguments are sent as one list of 4 byte parts that alternate between command and data,
+//every END toggles the D/C line through GPIOTE. Commands are padded with NOPs in front to fill their part
+#define SPI_DC_GPIOTE 7
+#define SPI_DC_PPI 12
+
+//single byte transfers stop the SPIM on the first SCK edge (PAN58), the GPIOTE channel must not be SPI_DC_GPIOTE
+#define SPI_PAN58_PPI 8
+#define SPI_PAN58_GPIOTE 6
+
+spi_stats_struct spi_stats;
+spi_stats_struct spi_frame_stats;
+
+volatile bool spi_async_busy = false;
+volatile bool spi_async_dc = false;
+uint8_t * volatile spi_async_ptr;
+volatile uint32_t spi_async_len;
+void (* volatile spi_async_callback)();
+
 void init_fast_spi() {
   pinMode(LCD_SCK, OUTPUT);
   pinMode(LCD_SDI, OUTPUT);
@@ -18,6 +47,26 @@ void init_fast_spi() {
   NRF_SPIM2->INTENSET = 0;
   NRF_SPIM2->ORC = 255;
   NRF_SPIM2->CONFIG = 0;
+
+  NVIC_ClearPendingIRQ(SPIM2_SPIS2_SPI2_IRQn);
+  NVIC_SetPriority(SPIM2_SPIS2_SPI2_IRQn, 3);
+  NVIC_EnableIRQ(SPIM2_SPIS2_SPI2_IRQn);
+
+  SPI_LIST_TIMER->MODE = TIMER_MODE_MODE_Counter;
+  SPI_LIST_TIMER->BITMODE = TIMER_BITMODE_BITMODE_16Bit;
+  SPI_LIST_TIMER->INTENSET = TIMER_INTENSET_COMPARE1_Msk;
+  NRF_PPI->CH[SPI_LIST_PPI_START].EEP = (uint32_t)(uintptr_t) &NRF_SPIM2->EVENTS_END;
+  NRF_PPI->CH[SPI_LIST_PPI_START].TEP = (uint32_t)(uintptr_t) &NRF_SPIM2->TASKS_START;
+  NRF_PPI->CH[SPI_LIST_PPI_COUNT].EEP = (uint32_t)(uintptr_t) &NRF_SPIM2->EVENTS_END;
+  NRF_PPI->CH[SPI_LIST_PPI_COUNT].TEP = (uint32_t)(uintptr_t) &SPI_LIST_TIMER->TASKS_COUNT;
+  NRF_PPI->CH[SPI_LIST_PPI_STOP].EEP = (uint32_t)(uintptr_t) &SPI_LIST_TIMER->EVENTS_COMPARE[0];
+  NRF_PPI->CH[SPI_LIST_PPI_STOP].TEP = (uint32_t)(uintptr_t) &NRF_PPI->TASKS_CHG[SPI_LIST_PPI_GROUP].DIS;
+  NRF_PPI->CHG[SPI_LIST_PPI_GROUP] = (1U << SPI_LIST_PPI_START);
+  NRF_PPI->CH[SPI_DC_PPI].EEP = (uint32_t)(uintptr_t) &NRF_SPIM2->EVENTS_END;
+  NRF_PPI->CH[SPI_DC_PPI].TEP = (uint32_t)(uintptr_t) &NRF_GPIOTE->TASKS_OUT[SPI_DC_GPIOTE];
+  NVIC_ClearPendingIRQ(SPI_LIST_TIMER_IRQn);
+  NVIC_SetPriority(SPI_LIST_TIMER_IRQn, 3);
+  NVIC_EnableIRQ(SPI_LIST_TIMER_IRQn);
 }
 
 void enable_spi(bool state) {
@@ -35,8 +84,8 @@ void enable_workaround(NRF_SPIM_Type * spim, uint32_t ppi_channel, uint32_t gpio
                                        (spim->PSEL.SCK << GPIOTE_CONFIG_PSEL_Pos) |
                                        (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos);
 
-  NRF_PPI->CH[ppi_channel].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[gpiote_channel];
-  NRF_PPI->CH[ppi_channel].TEP = (uint32_t) &spim->TASKS_STOP;
+  NRF_PPI->CH[ppi_channel].EEP = (uint32_t)(uintptr_t) &NRF_GPIOTE->EVENTS_IN[gpiote_channel];
+  NRF_PPI->CH[ppi_channel].TEP = (uint32_t)(uintptr_t) &spim->TASKS_STOP;
   NRF_PPI->CHENSET = 1U << ppi_channel;
 }
 
@@ -44,24 +93,31 @@ void disable_workaround(NRF_SPIM_Type * spim, uint32_t ppi_channel, uint32_t gpi
   NRF_GPIOTE->CONFIG[gpiote_channel] = 0;
   NRF_PPI->CH[ppi_channel].EEP = 0;
   NRF_PPI->CH[ppi_channel].TEP = 0;
-  NRF_PPI->CHENSET = ppi_channel;
+  NRF_PPI->CHENCLR = 1U << ppi_channel;
 }
 
 
 void write_fast_spi(uint8_t *ptr, uint32_t len) {
+  wait_fast_spi();
+  if (len >= SPI_LIST_MIN_LEN) {
+    write_fast_spi_async(ptr, len);
+    wait_fast_spi();
+    return;
+  }
   if (len == 1) {
-    enable_workaround(NRF_SPIM2, 8, 8);
+    enable_workaround(NRF_SPIM2, SPI_PAN58_PPI, SPI_PAN58_GPIOTE);
   } else {
-    disable_workaround(NRF_SPIM2, 8, 8);
+    disable_workaround(NRF_SPIM2, SPI_PAN58_PPI, SPI_PAN58_GPIOTE);
   }
 
+  spi_stats.bytes += len;
   int v2 = 0;
   do
   {
     NRF_SPIM2->EVENTS_END = 0;
     NRF_SPIM2->EVENTS_ENDRX = 0;
     NRF_SPIM2->EVENTS_ENDTX = 0;
-    NRF_SPIM2->TXD.PTR = (uint32_t) ptr + v2;
+    NRF_SPIM2->TXD.PTR = (uint32_t)(uintptr_t) ptr + v2;
     if ( len <= 0xFF )
     {
       NRF_SPIM2->TXD.MAXCNT = len;
@@ -77,8 +133,162 @@ void write_fast_spi(uint8_t *ptr, uint32_t len) {
     NRF_SPIM2->RXD.PTR = 0;
     NRF_SPIM2->RXD.MAXCNT = 0;
     NRF_SPIM2->TASKS_START = 1;
+    spi_stats.transfers++;
     while (NRF_SPIM2->EVENTS_END == 0);
     NRF_SPIM2->EVENTS_END = 0;
   }
   while ( len );
 }
+
+void count_spi_window() {
+  spi_stats.windows++;
+}
+
+void reset_spi_stats() {
+  memset(&spi_stats, 0, sizeof(spi_stats));
+}
+
+spi_stats_struct get_spi_stats() {
+  spi_stats.bus_us = (spi_stats.bytes * 8) / SPI_MHZ;
+  return spi_stats;
+}
+
+void end_spi_frame() {
+  spi_frame_stats = get_spi_stats();
+}
+
+spi_stats_struct get_spi_frame_stats() {
+  return spi_frame_stats;
+}
+
+void start_async_part() {
+  uint32_t part = spi_async_len;
+  if (part > 0xFF)part = 0xFF;
+  NRF_SPIM2->EVENTS_END = 0;
+  NRF_SPIM2->TXD.PTR = (uint32_t)(uintptr_t) spi_async_ptr;
+  NRF_SPIM2->TXD.MAXCNT = part;
+  NRF_SPIM2->RXD.PTR = 0;
+  NRF_SPIM2->RXD.MAXCNT = 0;
+  spi_async_ptr += part;
+  spi_async_len -= part;
+  spi_stats.transfers++;
+  NRF_SPIM2->TASKS_START = 1;
+}
+
+void start_list_part(uint32_t size) {
+  uint32_t parts = spi_async_len / size;
+  SPI_LIST_TIMER->TASKS_CLEAR = 1;
+  SPI_LIST_TIMER->CC[0] = parts - 1;
+  SPI_LIST_TIMER->CC[1] = parts;
+  SPI_LIST_TIMER->EVENTS_COMPARE[0] = 0;
+  SPI_LIST_TIMER->EVENTS_COMPARE[1] = 0;
+  SPI_LIST_TIMER->TASKS_START = 1;
+  NRF_PPI->CHENSET = SPI_LIST_CHANNELS;
+  NRF_SPIM2->EVENTS_END = 0;
+  NRF_SPIM2->TXD.LIST = SPIM_TXD_LIST_LIST_ArrayList << SPIM_TXD_LIST_LIST_Pos;
+  NRF_SPIM2->TXD.PTR = (uint32_t)(uintptr_t) spi_async_ptr;
+  NRF_SPIM2->TXD.MAXCNT = size;
+  NRF_SPIM2->RXD.PTR = 0;
+  NRF_SPIM2->RXD.MAXCNT = 0;
+  spi_async_ptr += parts * size;
+  spi_async_len -= parts * size;
+  spi_stats.transfers++;
+  NRF_SPIM2->TASKS_START = 1;
+}
+
+void end_async() {
+  NRF_SPIM2->INTENCLR = SPIM_INTENCLR_END_Msk;
+  if (spi_async_dc) {//the pin goes back to its GPIO level, LCD_RS is left HIGH
+    NRF_PPI->CHENCLR = 1U << SPI_DC_PPI;
+    NRF_GPIOTE->CONFIG[SPI_DC_GPIOTE] = 0;
+    spi_async_dc = false;
+  }
+  spi_async_busy = false;
+  if (spi_async_callback)spi_async_callback();
+}
+
+void write_fast_spi_async(uint8_t *ptr, uint32_t len, void (*callback)()) {
+  wait_fast_spi();
+  if (len <= 1) {//single bytes need the PAN58 workaround, do them blocking
+    write_fast_spi(ptr, len);
+    if (callback)callback();
+    return;
+  }
+  disable_workaround(NRF_SPIM2, SPI_PAN58_PPI, SPI_PAN58_GPIOTE);
+  spi_stats.bytes += len;
+  spi_async_ptr = ptr;
+  spi_async_len = len;
+  spi_async_callback = callback;
+  spi_async_busy = true;
+  if (len >= SPI_LIST_MIN_LEN) {
+    start_list_part(0xFF);
+  } else {
+    NRF_SPIM2->EVENTS_END = 0;
+    NRF_SPIM2->INTENSET = SPIM_INTENSET_END_Msk;
+    start_async_part();
+  }
+}
+
+void write_fast_spi_commands(uint8_t *ptr, uint32_t parts) {
+  //ptr starts with a command part, an odd number of parts leaves D/C HIGH for the data that follows
+  wait_fast_spi();
+  disable_workaround(NRF_SPIM2, SPI_PAN58_PPI, SPI_PAN58_GPIOTE);
+  spi_stats.bytes += parts * SPI_COMMAND_PART;
+  spi_async_ptr = ptr;
+  spi_async_len = parts * SPI_COMMAND_PART;
+  spi_async_callback = NULL;
+  spi_async_busy = true;
+  spi_async_dc = true;
+  NRF_GPIOTE->CONFIG[SPI_DC_GPIOTE] = (GPIOTE_CONFIG_MODE_Task << GPIOTE_CONFIG_MODE_Pos) |
+                                      (LCD_RS << GPIOTE_CONFIG_PSEL_Pos) |
+                                      (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos) |
+                                      (GPIOTE_CONFIG_OUTINIT_Low << GPIOTE_CONFIG_OUTINIT_Pos);
+  NRF_PPI->CHENSET = 1U << SPI_DC_PPI;
+  start_list_part(SPI_COMMAND_PART);
+}
+
+void wait_fast_spi() {
+  while (spi_async_busy);
+}
+
+bool get_fast_spi_busy() {
+  return spi_async_busy;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void SPIM2_SPIS2_SPI2_IRQHandler(void)
+{
+  if (NRF_SPIM2->EVENTS_END == 1)
+  {
+    NRF_SPIM2->EVENTS_END = 0;
+    if (!spi_async_busy)return;
+    if (spi_async_len) {
+      start_async_part();
+    } else {
+      end_async();
+    }
+  }
+}
+
+void TIMER3_IRQHandler(void)
+{
+  if (SPI_LIST_TIMER->EVENTS_COMPARE[1] == 1)
+  {
+    SPI_LIST_TIMER->EVENTS_COMPARE[1] = 0;
+    SPI_LIST_TIMER->TASKS_STOP = 1;
+    NRF_PPI->CHENCLR = SPI_LIST_CHANNELS;
+    NRF_SPIM2->TXD.LIST = SPIM_TXD_LIST_LIST_Disabled << SPIM_TXD_LIST_LIST_Pos;
+    if (spi_async_len) {//send the rest that did not fill a whole list part
+      NRF_SPIM2->EVENTS_END = 0;
+      NRF_SPIM2->INTENSET = SPIM_INTENSET_END_Msk;
+      start_async_part();
+    } else {
+      end_async();
+    }
+  }
+}
+#ifdef __cplusplus
+}
+#endif
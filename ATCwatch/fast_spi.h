@@ -3,8 +3,27 @@
 
 #include "Arduino.h"
 
+#define SPI_MHZ 8 //SPIM2 FREQUENCY 0x80000000
+#define SPI_COMMAND_PART 4
+
+struct spi_stats_struct {
+  uint32_t bytes;
+  uint32_t transfers;//DMA starts done by the CPU, list parts chained by PPI are not counted
+  uint32_t windows;
+  uint32_t bus_us;
+};
+
 void init_fast_spi();
 void enable_spi(bool state);
 void enable_workaround(NRF_SPIM_Type *spim, uint32_t ppi_channel, uint32_t gpiote_channel);
 void disable_workaround(NRF_SPIM_Type *spim, uint32_t ppi_channel, uint32_t gpiote_channel);
 void write_fast_spi(uint8_t *ptr, uint32_t len);
+void write_fast_spi_async(uint8_t *ptr, uint32_t len, void (*callback)() = NULL);
+void write_fast_spi_commands(uint8_t *ptr, uint32_t parts);
+void wait_fast_spi();
+bool get_fast_spi_busy();
+void count_spi_window();
+void reset_spi_stats();
+spi_stats_struct get_spi_stats();
+void end_spi_frame();
+spi_stats_struct get_spi_frame_stats();
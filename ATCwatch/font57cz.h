@@ -292,3 +292,46 @@ static const unsigned char font57[] = {
   0x00, 0x3C, 0x3C, 0x3C, 0x3C,//0xFD
   0x00, 0x00, 0x00, 0x00, 0x00 //0xFE
 };
+
+//Latin-1 Supplement, U+00A0 to U+00FF, 0 has no glyph
+static const unsigned char utf8_latin1[] = {
+  0x20, 0xAD, 0xBD, 0x9C, 0xCF, 0xBE, 0xDD, 0xF5,//- ¡ ¢ £ ¤ ¥ ¦ §
+  0xF9, 0xB8, 0xA6, 0xAE, 0xAA, 0xF0, 0xA9, 0xEE,//¨ © ª « ¬ - ® ¯
+  0xF8, 0xF1, 0xFD, 0xFC, 0xEF, 0xE6, 0xF4, 0xFA,//° ± - - ´ µ ¶ ·
+  0xF7, 0xFB, 0xA7, 0xAF, 0xAC, 0xAB, 0xF3, 0xA8,//¸ - º » - - - ¿
+  0xB7, 0xB5, 0x41, 0xC7, 0x8E, 0x8F, 0x41, 0x43,//À Á Â Ã Ä Å Æ Ç
+  0xD4, 0x90, 0x45, 0xD3, 0xDE, 0xD6, 0x49, 0xD8,//È É Ê Ë Ì Í Î Ï
+  0xD1, 0x4E, 0xE3, 0xE0, 0x4F, 0xE5, 0x99, 0x9E,//Ð Ñ Ò Ó Ô Õ Ö ×
+  0x4F, 0xEB, 0xE9, 0x55, 0x9A, 0xED, 0xE8, 0xE1,//Ø Ù Ú Û Ü Ý Þ ß
+  0x85, 0xA0, 0x61, 0xC6, 0x84, 0x86, 0x61, 0x63,//à á â ã ä å æ ç
+  0x8A, 0x82, 0x65, 0x89, 0x8D, 0xA1, 0x69, 0x8B,//è é ê ë ì í î ï
+  0xD0, 0x6E, 0x95, 0xA2, 0x6F, 0xE4, 0x94, 0xF6,//ð ñ ò ó ô õ ö ÷
+  0x6F, 0x97, 0xA3, 0x75, 0x81, 0xEC, 0xE7, 0x98,//ø ù ú û ü ý þ ÿ
+};
+
+//Latin Extended-A, all of Latin-2 but the spacing accents, U+0100 to U+017F, 0 has no glyph
+static const unsigned char utf8_latin_ext_a[] = {
+  0x41, 0x61, 0x41, 0x61, 0x41, 0x61, 0x43, 0x63,//Ā ā Ă ă Ą ą Ć ć
+  0x43, 0x63, 0x43, 0x63, 0x80, 0x87, 0x9D, 0x9B,//Ĉ ĉ Ċ ċ Č č Ď ď
+  0x44, 0x64, 0x45, 0x65, 0x45, 0x65, 0x45, 0x65,//Đ đ Ē ē Ĕ ĕ Ė ė
+  0x45, 0x65, 0xD2, 0x88, 0x47, 0x67, 0x47, 0x67,//Ę ę Ě ě Ĝ ĝ Ğ ğ
+  0x47, 0x67, 0x47, 0x67, 0x48, 0x68, 0x48, 0x68,//Ġ ġ Ģ ģ Ĥ ĥ Ħ ħ
+  0x49, 0x69, 0x49, 0x69, 0x49, 0x69, 0x49, 0x69,//Ĩ ĩ Ī ī Ĭ ĭ Į į
+  0x49, 0xD5, 0x49, 0x69, 0x4A, 0x6A, 0x4B, 0x6B,//İ ı Ĳ ĳ Ĵ ĵ Ķ ķ
+  0x6B, 0x4C, 0x6C, 0x4C, 0x6C, 0x4C, 0x6C, 0x4C,//ĸ Ĺ ĺ Ļ ļ Ľ ľ Ŀ
+  0x6C, 0x4C, 0x6C, 0x4E, 0x6E, 0x4E, 0x6E, 0xA5,//ŀ Ł ł Ń ń Ņ ņ Ň
+  0xA4, 0x6E, 0x4E, 0x6E, 0x4F, 0x6F, 0x4F, 0x6F,//ň ŉ Ŋ ŋ Ō ō Ŏ ŏ
+  0x4F, 0x6F, 0x4F, 0x6F, 0x52, 0x72, 0x52, 0x72,//Ő ő Œ œ Ŕ ŕ Ŗ ŗ
+  0x92, 0x91, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73,//Ř ř Ś ś Ŝ ŝ Ş ş
+  0xB6, 0x83, 0x54, 0x74, 0xD7, 0x8C, 0x54, 0x74,//Š š Ţ ţ Ť ť Ŧ ŧ
+  0x55, 0x75, 0x55, 0x75, 0x55, 0x75, 0xEA, 0x96,//Ũ ũ Ū ū Ŭ ŭ Ů ů
+  0x55, 0x75, 0x55, 0x75, 0x57, 0x77, 0x59, 0x79,//Ű ű Ų ų Ŵ ŵ Ŷ ŷ
+  0x59, 0x5A, 0x7A, 0x5A, 0x7A, 0xE2, 0x93, 0x73,//Ÿ Ź ź Ż ż Ž ž ſ
+};
+
+//Latin-2 spacing accents, U+02C7 to U+02DD, 0 has no glyph
+static const unsigned char utf8_spacing_accents[] = {
+  0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,//ˇ ˈ ˉ ˊ ˋ ˌ ˍ ˎ
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,//ˏ ː ˑ ˒ ˓ ˔ ˕ ˖
+  0x00, 0x5E, 0xFA, 0x00, 0xF7, 0x00, 0x22,//˗ ˘ ˙ ˚ ˛ ˜ ˝
+};
@@ -0,0 +1,56 @@
+#include "history.h"
+#include "time.h"
+#include "accl.h"
+#include "battery.h"
+#include "heartrate.h"
+
+//the records are kept in a ring in RAM, every record gets an index counting up since boot so a
+//phone can ask for everything after the last one it got, even when older ones are overwritten since
+history_record_struct history[HISTORY_RECORDS];
+uint32_t history_end = 0;//index of the next record
+bool history_due = true;
+
+void check_timed_history(int minutes) {
+  if (minutes % HISTORY_INTERVAL) {
+    history_due = true;
+    return;
+  }
+  if (!history_due)return;//only once per slot
+  history_due = false;
+  history_record_struct record;
+  record.timestamp = get_timestamp();
+  record.steps = get_accl_data().steps;
+  record.heartrate = get_last_heartrate();
+  record.battery = get_battery_percent();
+  add_history_record(record);
+}
+
+void add_history_record(history_record_struct record) {
+  history[history_end % HISTORY_RECORDS] = record;
+  history_end++;
+}
+
+uint32_t get_history_first() {
+  return history_end > HISTORY_RECORDS ? history_end - HISTORY_RECORDS : 0;
+}
+
+uint32_t get_history_end() {
+  return history_end;
+}
+
+bool get_history_record(uint32_t index, history_record_struct *record) {
+  if (index < get_history_first() || index >= history_end)return false;
+  *record = history[index % HISTORY_RECORDS];
+  return true;
+}
+
+uint32_t put_history_record(uint8_t *data, history_record_struct record) {
+  //low byte first like every other value sent, returns the bytes written
+  for (uint32_t i = 0; i < 4; i++) {
+    data[i] = record.timestamp >> (i * 8);
+    data[4 + i] = record.steps >> (i * 8);
+  }
+  data[8] = record.heartrate;
+  data[9] = record.battery;
+  return HISTORY_RECORD_SIZE;
+}
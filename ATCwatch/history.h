@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Arduino.h"
+
+#define HISTORY_RECORDS 192//two days of one record every HISTORY_INTERVAL minutes
+#define HISTORY_INTERVAL 15//minutes, the same slots the heart rate is measured in
+#define HISTORY_RECORD_SIZE 10//bytes of a record when sent: timestamp u32, steps u32, heart rate u8, battery % u8
+
+struct history_record_struct {
+  uint32_t timestamp;
+  uint32_t steps;
+  uint8_t heartrate;
+  uint8_t battery;
+};
+
+void check_timed_history(int minutes);
+void add_history_record(history_record_struct record);
+uint32_t get_history_first();
+uint32_t get_history_end();
+bool get_history_record(uint32_t index, history_record_struct *record);
+uint32_t put_history_record(uint8_t *data, history_record_struct record);
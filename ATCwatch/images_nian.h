@@ -1,4584 +1,1184 @@
-// 'frame_0_delay-0', 120x76px
-const uint16_t symbolNian1 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xe77e, 0xe77e, 0xa555, 0x11ec, 0xa555, 
-  0xe77e, 0xe77e, 0xe77e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x4372, 0x4c37, 0x8cf5, 0x8cf5, 0xa555, 0x8cf5, 0x8cf5, 0x9472, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x9472, 0xe77e, 0x8cf5, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x9472, 0xe77e, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x4372, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0xa555, 0x8cf5, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x3186, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x5188, 0x5188, 0x52ab, 0x5188, 0x52ab, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x52ab, 0x5188, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x5188, 0xc534, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0xfe95, 0xfe95, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 
-  0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xa555, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x736d, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfc82, 0xe323, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfdbb, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x9472, 
-  0x8906, 0x52ab, 0x736d, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x11ec, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0x83af, 0x5188, 0x5188, 0x5188, 0xc534, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x11ec, 0x5188, 0x5188, 0x5188, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x5188, 0x736d, 
-  0x8cf5, 0x8cf5, 0x9472, 0x5188, 0x52ab, 0xdcf4, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x0000, 0x1905, 
-  0x5188, 0x9472, 0x8cf5, 0xa555, 0x3186, 0x0084, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x52ab, 0xdcf4, 0xf49c, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x0000, 0x83af, 0x9472, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xce06, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x52ab, 0x9472, 0xc534, 0xc534, 0xc534, 0xc534, 0xc534, 0xc534, 0x736d, 0x5188, 0x9472, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0x9c4c, 0x3186, 0x1905, 0x52ab, 0xdf40, 0xff81, 
-  0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x0000, 
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x9c4c, 0x8bac, 0x52ab, 0x52ab, 0x52ab, 0x9c4c, 0xce06, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x9472, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x1082, 0x736d, 0xa555, 0xa555, 0x8430, 0x1082, 0x52ab, 
-  0xce06, 0xce06, 0x9c4c, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xc534, 0x5188, 0x83af, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x3186, 0x11ec, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x67c0, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x67c0, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xce06, 0x1082, 0x736d, 0xa555, 0xa555, 0x8430, 0x1082, 0x1082, 0x3186, 0x3186, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x5188, 0x3186, 0x9472, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5fc2, 0x3fc1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5e07, 0x2c67, 0x52ab, 0x8430, 0xa555, 0x9472, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x5188, 0x0000, 0x736d, 0xfe95, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x1905, 0x3186, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xc67a, 0xbdb5, 0x52ab, 0x8430, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xc67a, 0xc67a, 0x52ab, 0x8430, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x5fc2, 0x2c67, 0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xc67a, 0xbdb5, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0xa555, 0xa555, 0xc67a, 
-  0xc67a, 0x3186, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x372a, 0x5e07, 0x1905, 0x1905, 0x1905, 0x736d, 
-  0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x3186, 0x1082, 0x0000, 0x736d, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x736d, 0x1082, 0x8430, 0x8cf5, 0x3186, 0x0084, 0x0000, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 
-  0x372a, 0x372a, 0x372a, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x372a, 0x372a, 0x372a, 0x11ec, 0x11ec, 0x11ec, 0x52ab, 0x9472, 0x9472, 0x8430, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xc534, 0xdcf4, 0xc534, 0x83af, 0x736d, 0x736d, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x9472, 0xa555, 0x736d, 
-  0x736d, 0x736d, 0x9472, 0xc534, 0xc534, 0xc534, 0x3186, 0x1905, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x4372, 
-  0x3186, 0x3186, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0xa555, 0x8430, 0x9472, 0xa555, 
-  0xa555, 0xa555, 0x9472, 0x9472, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x4c37, 0x0084, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x1905, 0x83af, 0xa555, 0xa555, 0x9472, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0x3186, 
-  0x5188, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x157c, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xc534, 0x8430, 0x736d, 0x9472, 0xdcf4, 0xc534, 0xc534, 0xbdb5, 0x9472, 0x1905, 0x52ab, 0x736d, 
-  0x736d, 0x52ab, 0x1082, 0x3186, 0x736d, 0x736d, 0x736d, 0x1905, 0x3186, 0xa555, 0xc534, 0xc534, 0x9c4c, 0x736d, 0x3186, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfeda, 
-  0xfdbb, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x1082, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 
-  0x3186, 0x9472, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x0a0e, 0x1905, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x736d, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0x9472, 
-  0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0xa555, 0x736d, 0x1905, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x52de, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 
-  0x721f, 0x6a3f, 0x6a3f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x5a5b, 0x41f7, 0x52ab, 0x52ab, 0x1082, 0x5188, 0x9472, 0xdcf4, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xc534, 
-  0x736d, 0x736d, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x736d, 0x736d, 
-  0x83af, 0x83af, 0x52ab, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x9472, 0xe77e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x41f7, 
-  0x1905, 0x9472, 0x9472, 0x1905, 0x0000, 0x1905, 0xa555, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xbdb5, 0x736d, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 
-  0x3186, 0x3186, 0x3186, 0x3186, 0x1082, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8430, 0xc67a, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x5a5b, 0x21d0, 0x124e, 0x8430, 0xa555, 0xa555, 0x83af, 0x52ab, 0x1082, 0x52ab, 0x736d, 
-  0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x8bac, 0x736d, 0x8bac, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 
-  0x736d, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x52ab, 0x83af, 0x5188, 0x1082, 0x3186, 
-  0x11ec, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x52ab, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x6a3f, 0x5a5b, 0x6a3f, 0x41f7, 0x0084, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x0084, 0x0000, 0x0000, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x0084, 0x0084, 0x0084, 
-  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0000, 0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x1082, 0x1082, 
-  0x0000, 0x0000, 0x3186, 0x52ab, 0xa555, 0x52ab, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8430, 0x8430, 0x4372, 0x09ec, 0x124e, 0x8430, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x5a5b, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x52de, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 
-  0x41f7, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x0000, 0x52ab, 0xa555, 0xa555, 0x9472, 0x1905, 0x1905, 0x11ec, 0x1905, 0x0000, 
-  0x9472, 0x8cf5, 0x8cf5, 0x83af, 0x1082, 0x11ec, 0x09ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x11ec, 
-  0x1082, 0x8430, 0x8cf5, 0x8cf5, 0x8430, 0x1082, 0x1905, 0x11ec, 0x0084, 0x1905, 0x9472, 0x8cf5, 0xa555, 0x5188, 0x1082, 0x11ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x8cf5, 0xe77e, 0xe77e, 0xc67a, 0x124e, 0x9472, 0xe77e, 0x4372, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x0000, 0x1082, 
-  0x3186, 0x3186, 0x3186, 0x3186, 0x11ec, 0x09ec, 0x1905, 0x0000, 0x3186, 0x3186, 0x3186, 0x3186, 0x11ec, 0x09ec, 0x0a0e, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x1905, 0x3186, 0x3186, 0x3186, 0x1905, 0x11ec, 0x0a0e, 
-  0x09ec, 0x3186, 0x3186, 0x3186, 0x3186, 0x1082, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x4372, 0x4372, 0x4372, 0x0a0e, 0x21d0, 0x736d, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x83af, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8430, 0xe77e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x9472, 0xe77e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x124e, 0xa555, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xe77e, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0xc67a, 0xe77e, 0x4372, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xc67a, 0xc67a, 0xe77e, 0x8cf5, 0x124e, 0xc67a, 0xe77e, 0xc67a, 0xbdb5, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 
-  0xc67a, 0xc67a, 0x8cf5, 0x8cf5, 0xc67a, 0xc67a, 0xc67a, 0x8cf5, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0xc67a, 0xe77e, 0x4372, 0x124e, 0x124e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x124e, 0xc67a, 0xe77e, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 0xc67a, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+// 'frame_0_delay-0', 120x76px, run length encoded, the first frame the changes below start from
+const uint16_t symbolNian [] PROGMEM = {
+  1, 0x4e12, 56, 0x0e0a, 1, 0x4e12, 1, 0x7ac6, 2, 0x7ee7, 1, 0x55a5, 1, 0xec11, 1, 0x55a5, 
+  3, 0x7ee7, 1, 0x4e12, 51, 0x0e0a, 2, 0x4e12, 57, 0x0e0a, 1, 0x7243, 1, 0x374c, 2, 0xf58c, 
+  1, 0x55a5, 2, 0xf58c, 1, 0x7294, 1, 0xf58c, 1, 0x4e12, 51, 0x0e0a, 2, 0x4e12, 59, 0x0e0a, 
+  1, 0xec09, 1, 0x7294, 1, 0x7ee7, 1, 0xf58c, 55, 0x0e0a, 2, 0x4e12, 60, 0x0e0a, 1, 0x7294, 
+  1, 0x7ee7, 1, 0xf58c, 56, 0x0e0a, 1, 0x4e12, 60, 0x0e0a, 1, 0x7243, 1, 0x55a5, 1, 0x7243, 
+  56, 0x0e0a, 1, 0x4e12, 62, 0x0e0a, 1, 0xec09, 56, 0x0e0a, 1, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 
+  118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 
+  119, 0x0e0a, 1, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 
+  119, 0x0e0a, 1, 0x4e12, 119, 0x0e0a, 1, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 79, 0x0e0a, 1, 0x4e12, 
+  1, 0x55a5, 1, 0xf58c, 1, 0xec09, 35, 0x0e0a, 2, 0x4e12, 79, 0x0e0a, 1, 0x7243, 1, 0x55a5, 
+  1, 0xf58c, 14, 0x0e0a, 1, 0x4e12, 22, 0x0e0a, 1, 0x4e12, 79, 0x0e0a, 3, 0x4e12, 37, 0x0e0a, 
+  1, 0x4e12, 119, 0x0e0a, 1, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 1, 0x4e12, 4, 0x0e0a, 
+  1, 0xec11, 14, 0x0689, 1, 0xec11, 12, 0x0e0a, 1, 0x8851, 13, 0x0689, 1, 0x8631, 28, 0x0519, 
+  1, 0x8631, 43, 0x0e0a, 1, 0x4e12, 5, 0x0689, 14, 0xa2e8, 14, 0x0689, 12, 0xa2e8, 1, 0x23e3, 
+  2, 0x8851, 1, 0xab52, 1, 0x8851, 2, 0xab52, 12, 0x8851, 1, 0xab52, 9, 0x8851, 1, 0xab52, 
+  1, 0x8851, 1, 0xec11, 1, 0xec09, 41, 0x0e0a, 1, 0x4e12, 44, 0xa2e8, 1, 0x23e3, 1, 0x8851, 
+  1, 0x34c5, 10, 0x95fe, 1, 0xf4dc, 2, 0x95fe, 1, 0xf4dc, 3, 0x95fe, 1, 0xf4dc, 10, 0x95fe, 
+  1, 0x55a5, 1, 0x0519, 1, 0x8631, 41, 0x0e0a, 1, 0x4e12, 43, 0xa2e8, 1, 0x0689, 1, 0x6d73, 
+  1, 0x34c5, 4, 0x95fe, 1, 0xbbfd, 12, 0x1ffd, 1, 0xbbfd, 7, 0x1ffd, 1, 0xbbfd, 4, 0x95fe, 
+  1, 0x34c5, 1, 0xab52, 1, 0x0519, 1, 0xec09, 39, 0x0e0a, 1, 0x4e12, 42, 0xa2e8, 1, 0x23e3, 
+  1, 0x8210, 1, 0x6d73, 4, 0x95fe, 1, 0xbbfd, 9, 0x1ffd, 1, 0x9cf4, 12, 0x1ffd, 1, 0xbbfd, 
+  4, 0x95fe, 1, 0xab52, 1, 0x8210, 1, 0xec11, 39, 0x0e0a, 1, 0x4e12, 5, 0xa2e8, 14, 0x82fc, 
+  13, 0xa2e8, 1, 0x23e3, 9, 0x82fc, 1, 0x23e3, 1, 0x0519, 1, 0x6d73, 3, 0x95fe, 10, 0x1ffd, 
+  2, 0xb7ea, 1, 0x9cf4, 2, 0x1ffd, 1, 0x9cf4, 1, 0xb7ea, 1, 0x9cf4, 8, 0x1ffd, 3, 0x95fe, 
+  1, 0xab52, 1, 0x8210, 1, 0xec11, 39, 0x0e0a, 1, 0x4e12, 1, 0x82fc, 1, 0x23e3, 3, 0x82fc, 
+  13, 0x41fd, 15, 0x82fc, 9, 0x41fd, 1, 0x23e3, 1, 0x0519, 1, 0x6d73, 2, 0x95fe, 1, 0xbbfd, 
+  2, 0x1ffd, 2, 0x9cf4, 6, 0x1ffd, 2, 0x9cf4, 3, 0x1ffd, 1, 0x7294, 1, 0x0689, 1, 0xab52, 
+  1, 0x6d73, 1, 0x9cf4, 6, 0x1ffd, 1, 0xbbfd, 2, 0x95fe, 1, 0xab52, 1, 0x0000, 2, 0xec11, 
+  3, 0x0519, 1, 0xec11, 34, 0x0e0a, 1, 0x4e12, 42, 0x41fd, 1, 0x23e3, 1, 0x0519, 1, 0x6d73, 
+  1, 0x95fe, 1, 0xbbfd, 2, 0x1ffd, 1, 0x9cf4, 2, 0xb7ea, 9, 0x1ffd, 1, 0x9cf4, 1, 0xb7ea, 
+  1, 0xaf83, 3, 0x8851, 1, 0x34c5, 1, 0x9cf4, 6, 0x1ffd, 1, 0xbbfd, 1, 0x95fe, 1, 0x6d73, 
+  1, 0x8210, 2, 0xec11, 3, 0x8851, 1, 0x8631, 1, 0xec11, 33, 0x0e0a, 1, 0x4e12, 42, 0x41fd, 
+  1, 0x23e3, 1, 0x0519, 1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 3, 0x1ffd, 1, 0x9cf4, 10, 0x1ffd, 
+  1, 0x9cf4, 1, 0x8851, 1, 0x6d73, 2, 0xf58c, 1, 0x7294, 1, 0x8851, 1, 0xab52, 1, 0xf4dc, 
+  2, 0xb7ea, 3, 0x1ffd, 1, 0xbbfd, 1, 0x95fe, 1, 0x6d73, 1, 0x0000, 1, 0x0519, 1, 0x8851, 
+  1, 0x7294, 1, 0xf58c, 1, 0x55a5, 1, 0x8631, 1, 0x8400, 1, 0xec11, 32, 0x0e0a, 1, 0x4e12, 
+  5, 0x41fd, 14, 0x81ff, 14, 0x41fd, 9, 0x81ff, 1, 0x06ce, 1, 0x8631, 1, 0x6d73, 1, 0x95fe, 
+  1, 0xbbfd, 14, 0x1ffd, 1, 0x9cf4, 1, 0x8631, 1, 0x6d73, 3, 0x55a5, 1, 0x7294, 1, 0xaf83, 
+  1, 0xab52, 1, 0xf4dc, 1, 0x9cf4, 3, 0x1ffd, 1, 0xbbfd, 1, 0x95fe, 1, 0x6d73, 1, 0x0000, 
+  1, 0xaf83, 1, 0x7294, 3, 0x55a5, 1, 0x8631, 1, 0x8210, 1, 0xec11, 32, 0x0e0a, 1, 0x4e12, 
+  1, 0x06ce, 1, 0x81ff, 3, 0x41fd, 14, 0x81ff, 13, 0x41fd, 3, 0x81ff, 2, 0x40df, 5, 0x81ff, 
+  1, 0x40df, 1, 0x8631, 1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 14, 0x1ffd, 1, 0x9cf4, 1, 0x8631, 
+  1, 0x6d73, 4, 0x55a5, 1, 0x7294, 1, 0xab52, 1, 0x7294, 6, 0x34c5, 1, 0x6d73, 1, 0x8851, 
+  1, 0x7294, 4, 0x55a5, 1, 0x8631, 1, 0x8210, 1, 0xec11, 32, 0x0e0a, 1, 0x4e12, 34, 0x81ff, 
+  1, 0x4c9c, 1, 0x8631, 1, 0x0519, 1, 0xab52, 1, 0x40df, 3, 0x81ff, 1, 0x06ce, 1, 0x8631, 
+  1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 10, 0x1ffd, 1, 0xb7ea, 1, 0x9cf4, 2, 0x1ffd, 1, 0x9cf4, 
+  1, 0x8631, 1, 0x6d73, 6, 0x55a5, 1, 0xab52, 1, 0x0000, 5, 0x8210, 1, 0x3084, 6, 0x55a5, 
+  1, 0x8631, 1, 0x0000, 1, 0xec11, 32, 0x0e0a, 1, 0x4e12, 32, 0x81ff, 1, 0x40df, 1, 0x4c9c, 
+  1, 0xac8b, 3, 0xab52, 1, 0x4c9c, 1, 0x06ce, 2, 0x81ff, 1, 0x06ce, 1, 0x8631, 1, 0x6d73, 
+  1, 0x95fe, 1, 0xbbfd, 9, 0x1ffd, 1, 0x9cf4, 1, 0xb7ea, 1, 0x9cf4, 2, 0x1ffd, 1, 0x9cf4, 
+  1, 0x8631, 1, 0x6d73, 6, 0x55a5, 1, 0x7294, 2, 0xaf83, 1, 0x6d73, 3, 0xaf83, 1, 0x7294, 
+  6, 0x55a5, 1, 0x8631, 1, 0x0000, 1, 0xec11, 32, 0x0e0a, 1, 0x4e12, 5, 0x81ff, 14, 0x40df, 
+  13, 0x81ff, 1, 0x06ce, 1, 0x8210, 1, 0x6d73, 2, 0x55a5, 1, 0x3084, 1, 0x8210, 1, 0xab52, 
+  2, 0x06ce, 1, 0x4c9c, 1, 0x8631, 1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 5, 0x1ffd, 1, 0x9cf4, 
+  7, 0x1ffd, 1, 0x9cf4, 1, 0x34c5, 1, 0x8851, 1, 0xaf83, 20, 0x55a5, 1, 0xab52, 1, 0x8631, 
+  2, 0xec11, 31, 0x0e0a, 1, 0x4e12, 4, 0x81ff, 1, 0x40df, 1, 0xc067, 12, 0xc13f, 1, 0xc067, 
+  13, 0x81ff, 1, 0x06ce, 1, 0x8210, 1, 0x6d73, 2, 0x55a5, 1, 0x3084, 2, 0x8210, 2, 0x8631, 
+  1, 0x0519, 1, 0x0000, 1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 4, 0x1ffd, 1, 0x9cf4, 1, 0xb7ea, 
+  7, 0x1ffd, 1, 0x8851, 1, 0x8631, 1, 0x7294, 21, 0x55a5, 1, 0xf58c, 1, 0x7294, 1, 0x8631, 
+  1, 0x0519, 31, 0x0e0a, 1, 0x4e12, 5, 0xc067, 1, 0xc25f, 1, 0xc13f, 11, 0xe13f, 1, 0xc25f, 
+  13, 0xc067, 1, 0x075e, 1, 0x672c, 1, 0xab52, 1, 0x3084, 1, 0x55a5, 1, 0x7294, 4, 0xab52, 
+  1, 0x8851, 1, 0x0000, 1, 0x6d73, 1, 0x95fe, 6, 0x1ffd, 1, 0x9cf4, 6, 0x1ffd, 1, 0x9cf4, 
+  1, 0x0519, 1, 0x8631, 5, 0x55a5, 1, 0x7ac6, 1, 0xb5bd, 1, 0xab52, 1, 0x3084, 8, 0x55a5, 
+  2, 0x7ac6, 1, 0xab52, 1, 0x3084, 2, 0x55a5, 1, 0x7294, 1, 0x8631, 1, 0x0519, 31, 0x0e0a, 
+  1, 0x4e12, 1, 0xc25f, 1, 0xc13f, 30, 0xe13f, 1, 0xc13f, 1, 0xc25f, 1, 0x672c, 1, 0x8400, 
+  1, 0x7294, 5, 0x55a5, 1, 0x7294, 1, 0x0519, 1, 0x6d73, 1, 0x95fe, 12, 0x1ffd, 1, 0x9cf4, 
+  1, 0xb7ea, 2, 0x8631, 1, 0xf58c, 4, 0x55a5, 1, 0x7ac6, 1, 0xb5bd, 1, 0x8631, 1, 0x6d73, 
+  5, 0x55a5, 1, 0x7294, 2, 0x55a5, 2, 0x7ac6, 1, 0x8631, 1, 0x6d73, 2, 0x55a5, 1, 0x7294, 
+  1, 0x8631, 1, 0x0519, 31, 0x0e0a, 1, 0x4e12, 1, 0xc25f, 3, 0xe13f, 1, 0xc13f, 29, 0xe13f, 
+  1, 0x2a37, 1, 0x075e, 3, 0x0519, 1, 0x6d73, 2, 0x55a5, 1, 0x7294, 1, 0x0519, 1, 0x6d73, 
+  1, 0x95fe, 1, 0xbbfd, 1, 0x1ffd, 2, 0xb7ea, 9, 0x1ffd, 1, 0x9cf4, 2, 0x8631, 1, 0xf58c, 
+  3, 0x55a5, 1, 0xf58c, 1, 0x8631, 1, 0x8210, 1, 0x0000, 1, 0x6d73, 4, 0x55a5, 1, 0x6d73, 
+  1, 0x8210, 1, 0x3084, 1, 0xf58c, 1, 0x8631, 1, 0x8400, 1, 0x0000, 1, 0x6d73, 2, 0x55a5, 
+  1, 0x7294, 1, 0x8631, 1, 0x0519, 1, 0x4e12, 30, 0x0e0a, 1, 0x4e12, 1, 0xc25f, 3, 0xe13f, 
+  1, 0xc13f, 14, 0x2a37, 13, 0xe13f, 1, 0xc13f, 3, 0x2a37, 3, 0xec11, 1, 0xab52, 2, 0x7294, 
+  1, 0x3084, 1, 0x8210, 1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 1, 0x1ffd, 1, 0xb7ea, 1, 0x9cf4, 
+  10, 0x1ffd, 2, 0x8631, 1, 0xf58c, 1, 0x55a5, 1, 0x34c5, 1, 0xf4dc, 1, 0x34c5, 1, 0xaf83, 
+  2, 0x6d73, 1, 0x7294, 4, 0x55a5, 1, 0x7294, 1, 0x6d73, 1, 0x7294, 1, 0x55a5, 3, 0x6d73, 
+  1, 0x7294, 3, 0x34c5, 1, 0x8631, 1, 0x0519, 1, 0x4e12, 30, 0x0e0a, 1, 0x4e12, 1, 0xc25f, 
+  3, 0xc13f, 1, 0x2a37, 14, 0x7c15, 1, 0x2a37, 12, 0xc13f, 1, 0x2a37, 6, 0x7c15, 1, 0x7243, 
+  2, 0x8631, 1, 0x0519, 1, 0x0000, 1, 0x6d73, 1, 0x95fe, 14, 0x1ffd, 2, 0x8631, 1, 0xf58c, 
+  1, 0x34c5, 3, 0xf4dc, 1, 0x34c5, 1, 0x55a5, 1, 0x3084, 1, 0x7294, 3, 0x55a5, 2, 0x7294, 
+  3, 0x55a5, 2, 0x7294, 1, 0x55a5, 1, 0x34c5, 2, 0xf4dc, 1, 0x34c5, 1, 0x8631, 1, 0x0519, 
+  31, 0x0e0a, 1, 0x4e12, 5, 0x7c15, 14, 0x5f15, 14, 0x7c15, 6, 0x5f15, 3, 0x7c15, 1, 0x374c, 
+  1, 0x8400, 1, 0x6d73, 1, 0x95fe, 1, 0xbbfd, 8, 0x1ffd, 1, 0xb7ea, 1, 0x9cf4, 3, 0x1ffd, 
+  2, 0x8631, 1, 0xf58c, 1, 0x34c5, 3, 0xf4dc, 1, 0x34c5, 1, 0x7294, 1, 0x0519, 1, 0xaf83, 
+  2, 0x55a5, 1, 0x7294, 1, 0x8631, 1, 0x6d73, 3, 0x55a5, 1, 0x8631, 1, 0x8851, 1, 0xf58c, 
+  1, 0x34c5, 2, 0xf4dc, 1, 0x34c5, 1, 0x8631, 1, 0x0519, 31, 0x0e0a, 1, 0x4e12, 42, 0x5f15, 
+  1, 0x7c15, 1, 0x0519, 1, 0x6d73, 1, 0x95fe, 2, 0xbbfd, 2, 0x1ffd, 2, 0x9cf4, 3, 0x1ffd, 
+  1, 0xb7ea, 1, 0x9cf4, 3, 0x1ffd, 1, 0x34c5, 1, 0x3084, 1, 0x6d73, 1, 0x7294, 1, 0xf4dc, 
+  2, 0x34c5, 1, 0xb5bd, 1, 0x7294, 1, 0x0519, 1, 0xab52, 2, 0x6d73, 1, 0xab52, 1, 0x8210, 
+  1, 0x8631, 3, 0x6d73, 1, 0x0519, 1, 0x8631, 1, 0x55a5, 2, 0x34c5, 1, 0x4c9c, 1, 0x6d73, 
+  1, 0x8631, 1, 0xec11, 31, 0x0e0a, 1, 0x4e12, 1, 0x7c15, 40, 0x5f15, 1, 0x7c15, 1, 0x374c, 
+  1, 0x0519, 1, 0x6d73, 2, 0x95fe, 1, 0xdafe, 1, 0xbbfd, 1, 0x9cf4, 2, 0xb7ea, 9, 0x1ffd, 
+  1, 0xf4dc, 1, 0x8631, 1, 0x6d73, 4, 0x55a5, 1, 0x7294, 1, 0x0519, 1, 0x8210, 1, 0x0000, 
+  1, 0x8210, 3, 0x0000, 4, 0x8210, 1, 0x8631, 1, 0x7294, 2, 0x55a5, 1, 0x8631, 1, 0x8210, 
+  1, 0xec11, 31, 0x0e0a, 2, 0x4e12, 1, 0x7c15, 4, 0x5f15, 14, 0x7f2c, 13, 0x5f15, 8, 0x7f2c, 
+  1, 0xde52, 1, 0x0e0a, 1, 0x0519, 1, 0x8210, 1, 0x6d73, 4, 0x95fe, 1, 0xbbfd, 2, 0x9cf4, 
+  10, 0x1ffd, 1, 0xf4dc, 1, 0x6d73, 1, 0x8631, 1, 0x7294, 3, 0x55a5, 12, 0x7294, 1, 0x55a5, 
+  1, 0x6d73, 1, 0x0519, 1, 0xec11, 1, 0xec09, 32, 0x0e0a, 1, 0x7243, 1, 0x7ac6, 4, 0x7f2c, 
+  1, 0xde52, 1, 0x3f6a, 2, 0x1f72, 1, 0x3f6a, 5, 0x1f72, 1, 0x3f6a, 2, 0x1f72, 2, 0x3f6a, 
+  13, 0x7f2c, 1, 0xde52, 1, 0x3f6a, 2, 0x1f72, 1, 0x3f6a, 2, 0x1f72, 1, 0x5b5a, 1, 0xf741, 
+  2, 0xab52, 1, 0x8210, 1, 0x8851, 1, 0x7294, 1, 0xf4dc, 3, 0x95fe, 13, 0xbbfd, 1, 0x34c5, 
+  2, 0x6d73, 1, 0xaf83, 1, 0x6d73, 3, 0xaf83, 1, 0x6d73, 6, 0xaf83, 2, 0x6d73, 2, 0xaf83, 
+  1, 0xab52, 1, 0x0519, 34, 0x0e0a, 1, 0x7294, 1, 0x7ee7, 1, 0x3f6a, 11, 0x1f72, 1, 0x3f6a, 
+  25, 0x1f72, 1, 0x3f6a, 1, 0xf741, 1, 0x0519, 2, 0x7294, 1, 0x0519, 1, 0x0000, 1, 0x0519, 
+  1, 0x55a5, 17, 0x95fe, 1, 0xb5bd, 1, 0x6d73, 10, 0x8631, 1, 0x8210, 1, 0x0000, 4, 0x8210, 
+  1, 0xec11, 35, 0x0e0a, 1, 0x3084, 1, 0x7ac6, 2, 0x3f6a, 35, 0x1f72, 1, 0x5b5a, 1, 0xd021, 
+  1, 0x4e12, 1, 0x3084, 2, 0x55a5, 1, 0xaf83, 1, 0xab52, 1, 0x8210, 1, 0xab52, 9, 0x6d73, 
+  1, 0xac8b, 1, 0x6d73, 1, 0xac8b, 6, 0x6d73, 1, 0xab52, 9, 0x8851, 1, 0xab52, 1, 0xaf83, 
+  1, 0x8851, 1, 0x8210, 1, 0x8631, 2, 0xec11, 1, 0xec09, 35, 0x0e0a, 1, 0xec11, 1, 0xab52, 
+  1, 0x3f6a, 3, 0x1f72, 1, 0x3f6a, 13, 0x5b5a, 2, 0x3f6a, 1, 0x1f72, 1, 0x3f6a, 10, 0x1f72, 
+  1, 0x3f6a, 1, 0x5b5a, 1, 0x3f6a, 1, 0x5b5a, 1, 0x3f6a, 1, 0xf741, 1, 0x8400, 1, 0xab52, 
+  3, 0x55a5, 1, 0x7294, 1, 0xaf83, 1, 0x8400, 2, 0x0000, 3, 0x8631, 1, 0x0519, 1, 0x0000, 
+  11, 0x8400, 1, 0x0000, 1, 0x0519, 2, 0x8631, 1, 0x0519, 1, 0x0000, 2, 0x8210, 2, 0x0000, 
+  1, 0x8631, 1, 0xab52, 1, 0x55a5, 1, 0xab52, 1, 0x8210, 1, 0xec11, 33, 0x0e0a, 1, 0x4e12, 
+  2, 0x3084, 1, 0x7243, 1, 0xec09, 1, 0x4e12, 1, 0x3084, 4, 0x3f6a, 1, 0x5b5a, 1, 0xd021, 
+  12, 0x0e0a, 1, 0xd021, 1, 0xde52, 9, 0x3f6a, 2, 0x1f72, 1, 0x3f6a, 1, 0xf741, 1, 0xd021, 
+  3, 0x0e0a, 1, 0xec11, 1, 0x0000, 1, 0xab52, 2, 0x55a5, 1, 0x7294, 2, 0x0519, 1, 0xec11, 
+  1, 0x0519, 1, 0x0000, 1, 0x7294, 2, 0xf58c, 1, 0xaf83, 1, 0x8210, 1, 0xec11, 3, 0xec09, 
+  2, 0x0e0a, 4, 0xec09, 1, 0xec11, 1, 0x8210, 1, 0x3084, 2, 0xf58c, 1, 0x3084, 1, 0x8210, 
+  1, 0x0519, 1, 0xec11, 1, 0x8400, 1, 0x0519, 1, 0x7294, 1, 0xf58c, 1, 0x55a5, 1, 0x8851, 
+  1, 0x8210, 1, 0xec11, 1, 0xec09, 32, 0x0e0a, 1, 0xf58c, 2, 0x7ee7, 1, 0x7ac6, 1, 0x4e12, 
+  1, 0x7294, 1, 0x7ee7, 1, 0x7243, 4, 0xd021, 14, 0x0e0a, 14, 0xd021, 4, 0x0e0a, 1, 0xec11, 
+  1, 0x0000, 1, 0x8210, 4, 0x8631, 1, 0xec11, 1, 0xec09, 1, 0x0519, 1, 0x0000, 4, 0x8631, 
+  1, 0xec11, 1, 0xec09, 1, 0x0e0a, 1, 0xec09, 7, 0x0e0a, 1, 0xec11, 1, 0x8210, 1, 0x0519, 
+  3, 0x8631, 1, 0x0519, 1, 0xec11, 1, 0x0e0a, 1, 0xec09, 4, 0x8631, 2, 0x8210, 1, 0xec11, 
+  33, 0x0e0a, 1, 0xd021, 3, 0x7243, 1, 0x0e0a, 1, 0xd021, 1, 0x6d73, 37, 0x0e0a, 1, 0xec11, 
+  5, 0x0519, 1, 0xec09, 2, 0x0e0a, 1, 0xec11, 4, 0x0519, 1, 0x8631, 11, 0x0e0a, 1, 0xec09, 
+  5, 0x0519, 1, 0xec11, 3, 0x0e0a, 1, 0xec11, 5, 0x0519, 1, 0xec09, 38, 0x0e0a, 1, 0x4e12, 
+  1, 0xaf83, 44, 0x0e0a, 1, 0x4e12, 73, 0x0e0a, 1, 0x3084, 1, 0x7ee7, 1, 0x4e12, 117, 0x0e0a, 
+  1, 0x7294, 1, 0x7ee7, 1, 0x4e12, 117, 0x0e0a, 1, 0x7243, 1, 0x7ac6, 2, 0x4e12, 118, 0x0e0a, 
+  1, 0x4e12, 119, 0x0e0a, 1, 0x4e12, 238, 0x0e0a, 1, 0x4e12, 119, 0x0e0a, 1, 0x4e12, 119, 0x0e0a, 
+  2, 0x4e12, 118, 0x0e0a, 2, 0x4e12, 118, 0x0e0a, 1, 0x4e12, 58, 0x0e0a, 2, 0x4e12, 59, 0x0e0a, 
+  2, 0x4e12, 56, 0x0e0a, 1, 0x4e12, 1, 0x55a5, 1, 0x7ac6, 1, 0x4e12, 58, 0x0e0a, 1, 0x4e12, 
+  57, 0x0e0a, 1, 0x4e12, 1, 0x7ac6, 1, 0x7ee7, 1, 0xd021, 58, 0x0e0a, 1, 0x4e12, 55, 0x0e0a, 
+  3, 0x4e12, 1, 0x7ac6, 1, 0x7ee7, 1, 0x7243, 3, 0x4e12, 55, 0x0e0a, 2, 0x4e12, 53, 0x0e0a, 
+  1, 0xd021, 2, 0x7ac6, 1, 0x7ee7, 1, 0xf58c, 1, 0x4e12, 1, 0x7ac6, 1, 0x7ee7, 1, 0x7ac6, 
+  1, 0xb5bd, 1, 0xec09, 54, 0x0e0a, 1, 0x4e12, 54, 0x0e0a, 1, 0x4e12, 1, 0x55a5, 2, 0x7ac6, 
+  2, 0xf58c, 3, 0x7ac6, 1, 0xf58c, 1, 0xec09, 54, 0x0e0a, 2, 0x4e12, 54, 0x0e0a, 3, 0x4e12, 
+  1, 0x7ac6, 1, 0x7ee7, 1, 0x7243, 3, 0x4e12, 55, 0x0e0a, 2, 0x4e12, 56, 0x0e0a, 1, 0x4e12, 
+  1, 0x7ac6, 1, 0x7ee7, 1, 0xd021, 58, 0x0e0a, 2, 0x4e12, 1, 0x0e0a, 1, 0x4e12, 54, 0x0e0a, 
+  1, 0x4e12, 1, 0x55a5, 1, 0x7ac6, 1, 0xd021, 58, 0x0e0a, 1, 0x4e12, 119, 0x0e0a, 1, 0x4e12
 };
-// 'frame_1_delay-0', 120x76px
-const uint16_t symbolNian2 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xe77e, 0xe77e, 0xe77e, 0xa555, 0x0a0e, 
-  0xc67a, 0xc67a, 0x124e, 0x9472, 0xe77e, 0xe77e, 0xe77e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x124e, 0x9472, 0x8cf5, 0x8cf5, 0x4372, 0x0a0e, 0x8430, 0x4372, 0x0a0e, 0x21d0, 0x4c37, 0x4c37, 0x4c37, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x4372, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xc67a, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x21d0, 0xe77e, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 0xbdb5, 0x8430, 0x8cf5, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x8cf5, 0xa555, 0x8cf5, 0x8cf5, 0xa555, 0x4372, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0x8cf5, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x124e, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x11ec, 
-  0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 
-  0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x3186, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+// 'frame_0_delay-0', 120x76px, changes from frame 7
+const uint16_t symbolNianDelta1 [] PROGMEM = {
+  0x0060, 0x0039, 0x0113, 0x4e12, 0x7ac6, 0x7ee7, 0x7ee7, 0x55a5, 0xec11, 0x55a5, 0x7ee7, 0x7ee7, 0x7ee7, 0x4e12, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x013a, 0x0112, 0x7243, 0x374c, 0xf58c, 0xf58c, 0x55a5, 0xf58c, 0xf58c, 0x7294, 
+  0xf58c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0177, 0x0201, 0x4e12, 0x4e12, 0x023c, 0x010f, 
+  0xec09, 0x7294, 0x7ee7, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x033d, 
+  0x0203, 0x7294, 0x7ee7, 0xf58c, 0x7243, 0x55a5, 0x7243, 0x0a00, 0x0201, 0x4e12, 0x4e12, 0x0d5b, 0x0303, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1251, 0x0112, 0x55a5, 0xf58c, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1350, 0x0113, 0x7243, 0x55a5, 0xf58c, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x1450, 
+  0x0112, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x165b, 0x0303, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1800, 0x0301, 
+  0x0e0a, 0x0689, 0xa2e8, 0x1812, 0x0101, 0x0689, 0x1840, 0x0201, 0x0519, 0xab52, 0x184c, 0x0101, 0x0e0a, 0x192e, 0x0106, 0x8851, 
+  0x8851, 0xab52, 0x8851, 0xab52, 0xab52, 0x194a, 0x0104, 0xab52, 0x8851, 0xec11, 0xec09, 0x1a39, 0x0108, 0xf4dc, 0x95fe, 0x95fe, 
+  0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0xf4dc, 0x1a4d, 0x0102, 0x8631, 0x0e0a, 0x1b2a, 0x0102, 0xa2e8, 0x0689, 0x1b3f, 0x0101, 0xbbfd, 
+  0x1d20, 0x0101, 0x23e3, 0x1d2b, 0x0106, 0x0519, 0x6d73, 0x95fe, 0x95fe, 0x95fe, 0x1ffd, 0x1d49, 0x0105, 0x1ffd, 0x95fe, 0x95fe, 
+  0x95fe, 0xab52, 0x1e01, 0x0101, 0x23e3, 0x1e2e, 0x0104, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1e3f, 0x0116, 0x7294, 0x0689, 0xab52, 
+  0x6d73, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0xab52, 0x0000, 0xec11, 0xec11, 0x0519, 
+  0x0519, 0x0519, 0xec11, 0x1f3d, 0x0108, 0x9cf4, 0xb7ea, 0xaf83, 0x8851, 0x8851, 0x8851, 0x34c5, 0x9cf4, 0x1f50, 0x0106, 0xec11, 
+  0x8851, 0x8851, 0x8851, 0x8631, 0xec11, 0x203d, 0x011a, 0x9cf4, 0x8851, 0x6d73, 0xf58c, 0xf58c, 0x7294, 0x8851, 0xab52, 0xf4dc, 
+  0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x6d73, 0x0000, 0x0519, 0x8851, 0x7294, 0xf58c, 0x55a5, 0x8631, 0x8400, 
+  0xec11, 0x213e, 0x0119, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xaf83, 0xab52, 0xf4dc, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0xbbfd, 0x95fe, 0x6d73, 0x0000, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x8210, 0xec11, 0x2200, 0x0102, 0x06ce, 0x81ff, 
+  0x2218, 0x0102, 0x41fd, 0x41fd, 0x2223, 0x0108, 0x40df, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x2243, 0x0113, 
+  0x55a5, 0x7294, 0xab52, 0x7294, 0x34c5, 0x34c5, 0x34c5, 0x34c5, 0x34c5, 0x34c5, 0x6d73, 0x8851, 0x7294, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x8631, 0x8210, 0x2322, 0x0109, 0x4c9c, 0x8631, 0x0519, 0xab52, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x2344, 0x020c, 
+  0x55a5, 0x55a5, 0xab52, 0x0000, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xaf83, 
+  0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0x2420, 0x0107, 0x40df, 0x4c9c, 0xac8b, 0xab52, 0xab52, 0xab52, 
+  0x4c9c, 0x251f, 0x010c, 0x81ff, 0x06ce, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x3084, 0x8210, 0xab52, 0x06ce, 0x06ce, 0x4c9c, 0x253c, 
+  0x011c, 0x9cf4, 0x34c5, 0x8851, 0xaf83, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0x8631, 0xec11, 0xec11, 0x2605, 0x0106, 0xc067, 
+  0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0x261e, 0x010c, 0x81ff, 0x81ff, 0x06ce, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x3084, 0x8210, 
+  0x8210, 0x8631, 0x8631, 0x2635, 0x0123, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x8851, 0x8631, 0x7294, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x7294, 0x8631, 0x0519, 0x2708, 0x0107, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 
+  0xe13f, 0x271e, 0x0211, 0xc067, 0xc067, 0x075e, 0x672c, 0xab52, 0x3084, 0x55a5, 0x7294, 0xab52, 0xab52, 0xab52, 0xab52, 0x8851, 
+  0x0000, 0x6d73, 0x95fe, 0x1ffd, 0xe13f, 0xe13f, 0xc13f, 0xc25f, 0x672c, 0x8400, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x7294, 0x0519, 0x6d73, 0x95fe, 0x1ffd, 0x273c, 0x011c, 0x0519, 0x8631, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ac6, 0xb5bd, 
+  0xab52, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ac6, 0x7ac6, 0xab52, 0x3084, 0x55a5, 0x55a5, 
+  0x7294, 0x8631, 0x0519, 0x283a, 0x0119, 0x9cf4, 0xb7ea, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ac6, 0xb5bd, 
+  0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x55a5, 0x55a5, 0x7ac6, 0x7ac6, 0x8631, 0x6d73, 0x291f, 0x010b, 
+  0xe13f, 0xe13f, 0xe13f, 0x2a37, 0x075e, 0x0519, 0x0519, 0x0519, 0x6d73, 0x55a5, 0x55a5, 0x2942, 0x0117, 0xf58c, 0x8631, 0x8210, 
+  0x0000, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x6d73, 0x8210, 0x3084, 0xf58c, 0x8631, 0x8400, 0x0000, 0x6d73, 0x55a5, 0x55a5, 
+  0x7294, 0x8631, 0x0519, 0x4e12, 0x2a22, 0x0109, 0x2a37, 0x2a37, 0xec11, 0xec11, 0xec11, 0xab52, 0x7294, 0x7294, 0x3084, 0x2a40, 
+  0x0119, 0x34c5, 0xf4dc, 0x34c5, 0xaf83, 0x6d73, 0x6d73, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x7294, 0x55a5, 
+  0x6d73, 0x6d73, 0x6d73, 0x7294, 0x34c5, 0x34c5, 0x34c5, 0x8631, 0x0519, 0x4e12, 0x2b20, 0x010f, 0x2a37, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7243, 0x8631, 0x8631, 0x0519, 0x0000, 0x6d73, 0x95fe, 0x1ffd, 0x2b3f, 0x0117, 0x34c5, 0xf4dc, 0xf4dc, 
+  0xf4dc, 0x34c5, 0x55a5, 0x3084, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x55a5, 
+  0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x2c2b, 0x0101, 0x8400, 0x2c3f, 0x0113, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x34c5, 0x7294, 0x0519, 
+  0xaf83, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x8851, 0xf58c, 0x2d00, 0x0201, 0x5f15, 0x7c15, 
+  0x2d2a, 0x0101, 0x7c15, 0x2d38, 0x0120, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x34c5, 0x3084, 0x6d73, 0x7294, 0xf4dc, 0x34c5, 0x34c5, 
+  0xb5bd, 0x7294, 0x0519, 0xab52, 0x6d73, 0x6d73, 0xab52, 0x8210, 0x8631, 0x6d73, 0x6d73, 0x6d73, 0x0519, 0x8631, 0x55a5, 0x34c5, 
+  0x34c5, 0x4c9c, 0x6d73, 0x8631, 0xec11, 0x2e2f, 0x0101, 0xdafe, 0x2e3c, 0x021c, 0x1ffd, 0xf4dc, 0x8631, 0x6d73, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x7294, 0x0519, 0x8210, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x8210, 0x8210, 0x8210, 0x8210, 0x8631, 0x7294, 
+  0x55a5, 0x55a5, 0x8631, 0x8210, 0xec11, 0x0e0a, 0x1ffd, 0x1ffd, 0xf4dc, 0x6d73, 0x8631, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x7294, 
+  0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x55a5, 0x6d73, 0x0519, 0xec11, 0xec09, 
+  0x0e0a, 0x0e0a, 0x2e76, 0x0502, 0x4e12, 0x4e12, 0x7243, 0x7ac6, 0x7294, 0x7ee7, 0x3084, 0x7ac6, 0xec11, 0xab52, 0x2f29, 0x0108, 
+  0x0e0a, 0x0519, 0x8210, 0x6d73, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x3006, 0x010d, 0x1f72, 0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0x3022, 0x010a, 0x1f72, 0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x5b5a, 0xf741, 
+  0xab52, 0xab52, 0x8210, 0x303d, 0x011a, 0xbbfd, 0xbbfd, 0x34c5, 0x6d73, 0x6d73, 0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0x6d73, 
+  0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0x6d73, 0x6d73, 0xaf83, 0xaf83, 0xab52, 0x0519, 0x0e0a, 0x0e0a, 0x0e0a, 0x3128, 
+  0x0107, 0x0519, 0x7294, 0x7294, 0x0519, 0x0000, 0x0519, 0x55a5, 0x313f, 0x0116, 0x95fe, 0xb5bd, 0x6d73, 0x8631, 0x8631, 0x8631, 
+  0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8210, 0x0000, 0x8210, 0x8210, 0x8210, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 
+  0x3228, 0x012c, 0x3084, 0x55a5, 0x55a5, 0xaf83, 0xab52, 0x8210, 0xab52, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 
+  0x6d73, 0x6d73, 0xac8b, 0x6d73, 0xac8b, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0xab52, 0x8851, 0x8851, 0x8851, 0x8851, 
+  0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0xab52, 0xaf83, 0x8851, 0x8210, 0x8631, 0xec11, 0xec11, 0xec09, 0x0e0a, 0x3300, 0x0106, 
+  0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x3313, 0x0103, 0x3f6a, 0x1f72, 0x3f6a, 0x3322, 0x0101, 0x3f6a, 0x332c, 0x0101, 
+  0xaf83, 0x3337, 0x011c, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x0000, 0x0519, 0x8631, 0x8631, 
+  0x0519, 0x0000, 0x8210, 0x8210, 0x0000, 0x0000, 0x8631, 0xab52, 0x55a5, 0xab52, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x3371, 
+  0x0307, 0x4e12, 0x3084, 0x3084, 0x7243, 0xec09, 0x4e12, 0x3084, 0xf58c, 0x7ee7, 0x7ee7, 0x7ac6, 0x4e12, 0x7294, 0x7ee7, 0xd021, 
+  0x7243, 0x7243, 0x7243, 0x0e0a, 0xd021, 0x6d73, 0x3401, 0x0102, 0x3f6a, 0x3f6a, 0x3413, 0x013e, 0xde52, 0x3f6a, 0x3f6a, 0x3f6a, 
+  0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x3f6a, 0xf741, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0000, 
+  0xab52, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x0519, 0xec11, 0x0519, 0x0000, 0x7294, 0xf58c, 0xf58c, 0xaf83, 0x8210, 0xec11, 0xec09, 
+  0xec09, 0xec09, 0x0e0a, 0x0e0a, 0xec09, 0xec09, 0xec09, 0xec09, 0xec11, 0x8210, 0x3084, 0xf58c, 0xf58c, 0x3084, 0x8210, 0x0519, 
+  0xec11, 0x8400, 0x0519, 0x7294, 0xf58c, 0x55a5, 0x8851, 0x8210, 0xec11, 0xec09, 0x3526, 0x0123, 0x0000, 0x8210, 0x8631, 0x8631, 
+  0x8631, 0x8631, 0xec11, 0xec09, 0x0519, 0x0000, 0x8631, 0x8631, 0x8631, 0x8631, 0xec11, 0xec09, 0x0e0a, 0xec09, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x8210, 0x0519, 0x8631, 0x8631, 0x8631, 0x0519, 0xec11, 0x0e0a, 0xec09, 0x362b, 
+  0x010b, 0xec09, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0x8631, 0x0e0a, 0x0e0a, 0x363f, 0x0108, 0xec09, 0x0519, 
+  0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0x0e0a, 0x3676, 0x0402, 0x4e12, 0xaf83, 0x3084, 0x7ee7, 0x7294, 0x7ee7, 0x7243, 0x7ac6, 
+  0x372c, 0x0108, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3800, 0x0101, 0x4e12, 0x3b00, 0x0101, 0x4e12, 
+  0x4148, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x423a, 0x0102, 0x4e12, 0x4e12, 0x4247, 0x0304, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4339, 0x0204, 0x4e12, 0x55a5, 0x7ac6, 0x4e12, 0x4e12, 0x7ac6, 0x7ee7, 
+  0xd021, 0x4500, 0x0101, 0x0e0a, 0x4537, 0x0118, 0x4e12, 0x4e12, 0x4e12, 0x7ac6, 0x7ee7, 0x7243, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4636, 0x021a, 
+  0xd021, 0x7ac6, 0x7ac6, 0x7ee7, 0xf58c, 0x4e12, 0x7ac6, 0x7ee7, 0x7ac6, 0xb5bd, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x55a5, 0x7ac6, 0x7ac6, 0xf58c, 0xf58c, 
+  0x7ac6, 0x7ac6, 0x7ac6, 0xf58c, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4700, 0x0101, 0x0e0a, 0x4837, 0x0118, 0x4e12, 0x4e12, 0x4e12, 0x7ac6, 0x7ee7, 0x7243, 0x4e12, 
+  0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x4939, 0x0204, 0x4e12, 0x7ac6, 0x7ee7, 0xd021, 0x4e12, 0x55a5, 0x7ac6, 0xd021, 0x4948, 0x0303, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4a02, 0x0101, 0x4e12, 0x4b00, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a
+};
+// 'frame_1_delay-0', 120x76px, changes from frame 0
+const uint16_t symbolNianDelta2 [] PROGMEM = {
+  0x0049, 0x002a, 0x021a, 0xd021, 0x7ee7, 0x7ee7, 0x7ee7, 0x55a5, 0x0e0a, 0x7ac6, 0x7ac6, 0x4e12, 0x7294, 0x7ee7, 0x7ee7, 0x7ee7, 
+  0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7294, 0xf58c, 
+  0xf58c, 0x7243, 0x0e0a, 0x3084, 0x7243, 0x0e0a, 0xd021, 0x374c, 0x374c, 0x374c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0230, 0x0102, 0x7243, 0x4e12, 0x023c, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0330, 0x0303, 0x7ac6, 0x7ac6, 0x4e12, 0x7ac6, 0x7ac6, 0x4e12, 0x7ac6, 0x55a5, 0x4e12, 0x033d, 0x0203, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0630, 0x0102, 0x4e12, 0x4e12, 0x0a00, 0x0201, 0x0e0a, 0x0e0a, 0x1049, 0x0203, 0x4e12, 0xf58c, 
+  0x7243, 0xd021, 0x7ee7, 0xf58c, 0x1248, 0x020b, 0x55a5, 0xb5bd, 0x3084, 0xf58c, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 
+  0x0e0a, 0xf58c, 0x55a5, 0xf58c, 0xf58c, 0x55a5, 0x7243, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0x1449, 0x010a, 0x4e12, 0x7ac6, 
+  0xf58c, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1549, 0x0103, 0x4e12, 0x7243, 0x4e12, 0x162e, 0x021e, 0xec09, 
+  0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 
+  0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec09, 0x8631, 0x8210, 0x0000, 
   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x8906, 0x8906, 0x8906, 0x5188, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x11ec, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x736d, 0x9c4c, 
-  0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 
-  0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9472, 0x8430, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x11ec, 0x3186, 0x736d, 0x9472, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfeda, 0xfeda, 0xfeda, 0xfeda, 
-  0xfeda, 0xfeda, 0xfdbb, 0xfeda, 0xfeda, 0xfeda, 0xfeda, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfeda, 0xfeda, 0xfeda, 
-  0xfe95, 0xfe95, 0xfe95, 0xc534, 0x736d, 0x52ab, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x52ab, 0xdcf4, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x9c4c, 0x0084, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0x9c4c, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfeda, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0x9c4c, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfd41, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x9c4c, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0x83af, 0x736d, 0x83af, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x9c4c, 0x0000, 0x11ec, 
-  0x11ec, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xdcf4, 0x9472, 0x5188, 0x5188, 0x5188, 0xc534, 0xf49c, 0xfd1f, 0xf49c, 0xeab7, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x9c4c, 0x1082, 0x1905, 0x11ec, 0x5188, 0x5188, 0x5188, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x5188, 0x52ab, 
-  0x9472, 0x8cf5, 0x9472, 0x3186, 0x52ab, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x9c4c, 0x0000, 0x1082, 
-  0x3186, 0x9472, 0x8cf5, 0xa555, 0x3186, 0x0084, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xce06, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x9c4c, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0x83af, 0x736d, 0x83af, 0xc534, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x9c4c, 0x0000, 0x52ab, 0x83af, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xce06, 0x1082, 0x0000, 0x1082, 0x1082, 0x1082, 0x0000, 0x736d, 0xce06, 0xfd41, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xf49c, 0xf49c, 0xf49c, 0xf49c, 0xfdbb, 0xdcf4, 0x9c4c, 0x1082, 0x9472, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x1082, 0x52ab, 0x9472, 0x9472, 0x83af, 0x1082, 0x1082, 
-  0x3186, 0xce06, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x3186, 
-  0x1905, 0x3186, 0x1905, 0x1905, 0x1905, 0x736d, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xce06, 0x1082, 0x3186, 0x52ab, 0xa555, 0x8cf5, 0x83af, 0x52ab, 0x0000, 0x5188, 0x736d, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x83af, 0x736d, 0x83af, 0x736d, 0x736d, 0x8430, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xce06, 0x52ab, 0x3186, 0x0084, 0x9472, 0x9472, 0xa555, 0x83af, 
-  0x3186, 0x1905, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xc534, 0x5188, 0x52ab, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x3186, 0x11ec, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x67c0, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x67c0, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x67c0, 0xdf40, 
-  0xff81, 0xce06, 0x8bac, 0x0000, 0x1905, 0x52ab, 0xa555, 0xa555, 0x9472, 0x52ab, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0x5188, 0x3186, 0x9472, 0x8cf5, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x5fc2, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x5e07, 0x2c67, 0x1082, 0x3186, 0x83af, 0x9472, 
-  0xa555, 0x8430, 0x5188, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0x3186, 0x3186, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xc67a, 0xbdb5, 0x8430, 0x9472, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xc67a, 0xbdb5, 0x8430, 0x8430, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x5fc2, 0x1905, 0x0000, 0x0000, 0x52ab, 0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xe77e, 0xc67a, 0x3186, 0x52ab, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 
-  0xc67a, 0x3186, 0x5188, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x5e07, 0x2c67, 0x1082, 0x1082, 
-  0x1905, 0x1905, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x52ab, 0x3186, 0x0000, 0x52ab, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x736d, 0x8cf5, 0x52ab, 0x3186, 0x1082, 0x5188, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x372a, 0x372a, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x3fe1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x372a, 0x5e07, 0x5e07, 0x5e07, 0x3186, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xc534, 0xdcf4, 0xc534, 0x83af, 0x736d, 0x736d, 0x83af, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x8430, 0xa555, 0x736d, 
-  0x736d, 0x736d, 0x8430, 0xc534, 0xc534, 0xc534, 0x3186, 0x0084, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x372a, 0x372a, 
-  0x372a, 0x2c67, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x8cf5, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x4c37, 0x0084, 0x736d, 0xfe95, 0xfe95, 0xfdbb, 
-  0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x1905, 0x3186, 0x8cf5, 0xc534, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x5188, 0x52ab, 0xa555, 0xa555, 0x9472, 0x52ab, 0x52ab, 0xa555, 0xa555, 0xa555, 0x52ab, 
-  0x52ab, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x157c, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfeda, 0xfdbb, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x736d, 0x52ab, 0x83af, 0x9472, 0xdcf4, 0xdcf4, 0xc534, 0xbdb5, 0x9472, 0x1082, 0x3186, 0x8430, 
-  0x8430, 0x83af, 0x1905, 0x3186, 0x8430, 0x8430, 0x8430, 0x3186, 0x3186, 0xa555, 0xc534, 0xdcf4, 0xc534, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x4c37, 0x1905, 0x52ab, 0xbdb5, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xdcf4, 0x3186, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x1082, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 
-  0x3186, 0x9472, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x4372, 0x1905, 0x1082, 0x1082, 0x3186, 0x8430, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x9472, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0x9472, 
-  0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0xa555, 0x8430, 0x3186, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x4372, 0xc67a, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x5a5b, 0x4372, 0x124e, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x736d, 0x9472, 
-  0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x8bac, 
-  0x0000, 0x5188, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x736d, 0x736d, 
-  0x83af, 0x83af, 0x52ab, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8cf5, 0x124e, 0x4372, 0xa555, 0x9472, 0x0a0e, 0x4372, 0x4c37, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x721f, 0x41f7, 
-  0x1082, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0x736d, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 
-  0x0000, 0x1082, 0x1082, 0x1082, 0x0000, 0x0000, 0x1082, 0x1082, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 
-  0x1082, 0x1082, 0x0000, 0x1082, 0x1082, 0x0000, 0x1082, 0x0000, 0x0000, 0x1082, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0xc67a, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 0xc67a, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x41f7, 0x0000, 0x736d, 0xa555, 0xa555, 0x8430, 0x52ab, 0x3186, 0x0000, 
-  0x1905, 0x1905, 0x0000, 0x3186, 0x83af, 0x83af, 0x736d, 0x1082, 0x0084, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 
-  0x11ec, 0x1905, 0x1082, 0x736d, 0x83af, 0x83af, 0x52ab, 0x0000, 0x1905, 0x1905, 0x0084, 0x3186, 0x83af, 0x83af, 0x83af, 0x1905, 
-  0x0084, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x21d0, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x5a5b, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x41f7, 
-  0x0000, 0x52ab, 0x9472, 0x9472, 0x736d, 0x1082, 0x0000, 0x0084, 0x11ec, 0x11ec, 0x1082, 0x5188, 0x9472, 0x9472, 0x8430, 0x3186, 
-  0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x0084, 0x8430, 0x9472, 0x9472, 0x736d, 0x0000, 
-  0x3186, 0x11ec, 0x1905, 0x3186, 0x8430, 0x9472, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x4372, 0x4372, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8430, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x5a5b, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 
-  0x6a3f, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x5a5b, 
-  0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x21d0, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x1905, 0x09ec, 
-  0x0a0e, 0x11ec, 0x1082, 0x0000, 0x0000, 0x0000, 0x0084, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x11ec, 0x0084, 0x0000, 0x0000, 0x0000, 0x1082, 0x11ec, 0x09ec, 0x09ec, 0x11ec, 0x1082, 0x0000, 0x1082, 0x1905, 
-  0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0xe77e, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xe77e, 0xa555, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 
-  0x11ec, 0x3186, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x11ec, 0x3186, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x4372, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 0xc67a, 0x124e, 
-  0x124e, 0x124e, 0x124e, 0x0a0e, 0x8cf5, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x21d0, 0x4372, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x8cf5, 0x8430, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0xc67a, 0xa555, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xc67a, 
-  0x124e, 0x8cf5, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x9472, 0xa555, 0xa555, 0x9472, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0519, 0x1800, 0x014e, 0x0689, 0x0689, 0x0689, 
+  0x8851, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x6d73, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 
+  0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 
+  0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x7294, 0x3084, 0x0519, 0xec11, 0x1900, 0x0150, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x23e3, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0xec11, 0x8631, 0x6d73, 0x7294, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0xbbfd, 0xdafe, 0xdafe, 0xdafe, 0xdafe, 0xdafe, 0xdafe, 0xbbfd, 0xdafe, 0xdafe, 0xdafe, 0xdafe, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 
+  0xbbfd, 0xbbfd, 0xdafe, 0xdafe, 0xdafe, 0x95fe, 0x95fe, 0x95fe, 0x34c5, 0x6d73, 0xab52, 0xec11, 0xec09, 0x1a2a, 0x0226, 0x23e3, 
+  0x8210, 0xab52, 0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x4c9c, 0x8400, 0xec11, 0x23e3, 0x8210, 0x6d73, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x95fe, 0x4c9c, 0x8210, 0xec11, 0x1c2f, 0x011f, 0xdafe, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x4c9c, 0x1d00, 0x014e, 0x82fc, 0x82fc, 
+  0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x4c9c, 0x1e00, 0x0130, 0x41fd, 0x41fd, 
+  0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x23e3, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1e3a, 0x0114, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xaf83, 0x6d73, 0xaf83, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0xbbfd, 0x95fe, 0x4c9c, 0x1f31, 0x0103, 0x1ffd, 0x1ffd, 0x1ffd, 0x1f3e, 0x0112, 0xf4dc, 0x7294, 0x8851, 0x8851, 0x8851, 
+  0x34c5, 0x9cf4, 0x1ffd, 0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x4c9c, 0x8210, 0x0519, 0x2032, 0x0101, 0x1ffd, 
+  0x203f, 0x0112, 0xab52, 0x7294, 0xf58c, 0x7294, 0x8631, 0xab52, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 
+  0x4c9c, 0x0000, 0x8210, 0x8631, 0x2100, 0x012c, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x06ce, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0x4c9c, 0x41fd, 0x41fd, 
+  0x23e3, 0x0519, 0x2139, 0x0118, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0x6d73, 
+  0xaf83, 0x34c5, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x95fe, 0x4c9c, 0x0000, 0xab52, 0xaf83, 0x2200, 0x012b, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8210, 
+  0x0000, 0x8210, 0x8210, 0x8210, 0x0000, 0x6d73, 0x06ce, 0x41fd, 0x06ce, 0x2238, 0x0117, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x6d73, 0x9cf4, 0x9cf4, 0x9cf4, 0x9cf4, 0xbbfd, 0xf4dc, 
+  0x4c9c, 0x8210, 0x2320, 0x010b, 0x06ce, 0x8210, 0xab52, 0x7294, 0x7294, 0xaf83, 0x8210, 0x8210, 0x8631, 0x06ce, 0x40df, 0x2339, 
+  0x0116, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xaf83, 0x8631, 
+  0x0519, 0x8631, 0x0519, 0x0519, 0x0519, 0x6d73, 0x7294, 0x2420, 0x0120, 0x06ce, 0x8210, 0x8631, 0xab52, 0x55a5, 0xf58c, 0xaf83, 
+  0xab52, 0x0000, 0x8851, 0x6d73, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0x9cf4, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x244b, 0x0103, 0x6d73, 0x6d73, 0x3084, 0x2500, 0x0240, 
+  0x40df, 0x40df, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x81ff, 
+  0x06ce, 0xab52, 0x8631, 0x8400, 0x7294, 0x7294, 0x55a5, 0xaf83, 0x8631, 0x0519, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x34c5, 0x8851, 0xab52, 
+  0xc25f, 0xc13f, 0xc067, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x40df, 0xc067, 0xc13f, 0xc13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xc067, 0x40df, 
+  0x81ff, 0x06ce, 0xac8b, 0x0000, 0x0519, 0xab52, 0x55a5, 0x55a5, 0x7294, 0xab52, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x8851, 0x8631, 0x7294, 0xf58c, 
+  0x2700, 0x0147, 0xc25f, 0xc25f, 0xc25f, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 
+  0xc067, 0xc067, 0xc067, 0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 
+  0xc25f, 0xc067, 0xc067, 0xc067, 0x075e, 0x672c, 0x8210, 0x8631, 0xaf83, 0x7294, 0x55a5, 0x3084, 0x8851, 0x0000, 0x6d73, 0x95fe, 
+  0xbbfd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x8631, 0x8631, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ac6, 0xb5bd, 0x3084, 0x7294, 0x2750, 0x0102, 0xb5bd, 0x3084, 0x2821, 0x0132, 0xc13f, 
+  0xc13f, 0xc25f, 0x0519, 0x0000, 0x0000, 0xab52, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0xb7ea, 0xb7ea, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 
+  0x8851, 0x2922, 0x0110, 0xe13f, 0xc13f, 0x075e, 0x672c, 0x8210, 0x8210, 0x0519, 0x0519, 0x0519, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 
+  0x1ffd, 0x9cf4, 0x9cf4, 0x293b, 0x011e, 0x1ffd, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0xab52, 0x8631, 0x0000, 
+  0xab52, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x6d73, 0xf58c, 0xab52, 0x8631, 0x8210, 0x8851, 0x55a5, 0x55a5, 0x7294, 
+  0x8631, 0x0519, 0x0e0a, 0x2a00, 0x0239, 0x2a37, 0x2a37, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 
+  0x2a37, 0x2a37, 0x2a37, 0x2a37, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xe13f, 0xe13f, 0x2a37, 0x075e, 0x075e, 0x075e, 0x8631, 0x0000, 
+  0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x7c15, 0x7c15, 
+  0x7c15, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x672c, 0x0519, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0xb7ea, 0x2a46, 0x0113, 0xaf83, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x6d73, 
+  0x3084, 0x55a5, 0x6d73, 0x6d73, 0x6d73, 0x3084, 0x34c5, 0x34c5, 0x34c5, 0x8631, 0x8400, 0x0e0a, 0x2b45, 0x010c, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xf58c, 0x2c00, 0x0151, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x374c, 0x8400, 0x6d73, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x0519, 0x8631, 0xf58c, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x34c5, 
+  0x7294, 0x8851, 0xab52, 0x55a5, 0x55a5, 0x7294, 0xab52, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0xab52, 0x2d2e, 0x012a, 0x95fe, 
+  0xdafe, 0xbbfd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x6d73, 0xab52, 0xaf83, 
+  0x7294, 0xf4dc, 0xf4dc, 0x34c5, 0xb5bd, 0x7294, 0x8210, 0x8631, 0x3084, 0x3084, 0xaf83, 0x0519, 0x8631, 0x3084, 0x3084, 0x3084, 
+  0x8631, 0x8631, 0x55a5, 0x34c5, 0xf4dc, 0x34c5, 0x7294, 0x8631, 0x0519, 0x2e2c, 0x0114, 0xab52, 0xb5bd, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0xf4dc, 0x8631, 0xab52, 0x2e76, 
+  0x0202, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x2f00, 0x0242, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x7243, 0x0519, 0x8210, 0x8210, 0x8631, 0x3084, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x34c5, 0x7294, 0x8631, 0x6d73, 0x3f6a, 0x3f6a, 0x3f6a, 0xde52, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x3f6a, 
+  0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x5b5a, 0x7243, 0x4e12, 0xab52, 0xab52, 0xab52, 0xab52, 0x6d73, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 
+  0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0xac8b, 0x0000, 0x8851, 0x2f52, 0x0102, 0x3084, 0x8631, 0x2f68, 
+  0x0103, 0x7243, 0x7ac6, 0x55a5, 0x3054, 0x0101, 0xec11, 0x3065, 0x0113, 0x7243, 0xf58c, 0x4e12, 0x7243, 0x55a5, 0x7294, 0x0e0a, 
+  0x7243, 0x374c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x3124, 0x012f, 0x3f6a, 0x3f6a, 
+  0x1f72, 0xf741, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x6d73, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x8210, 0x8210, 
+  0x8210, 0x0000, 0x0000, 0x8210, 0x8210, 0x8210, 0x0000, 0x0000, 0x8210, 0x8210, 0x0000, 0x0000, 0x0000, 0x8210, 0x8210, 0x8210, 
+  0x8210, 0x0000, 0x8210, 0x8210, 0x0000, 0x8210, 0x8210, 0x0000, 0x8210, 0x0000, 0x0000, 0x8210, 0x0519, 0x3164, 0x0114, 0x4e12, 
+  0xf58c, 0x7ac6, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x55a5, 0x7ac6, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x4e12, 0x3225, 0x012c, 0x3f6a, 0x1f72, 0xf741, 0x0000, 0x6d73, 0x55a5, 0x55a5, 0x3084, 0xab52, 0x8631, 0x0000, 
+  0x0519, 0x0519, 0x0000, 0x8631, 0xaf83, 0xaf83, 0x6d73, 0x8210, 0x8400, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 
+  0xec11, 0x0519, 0x8210, 0x6d73, 0xaf83, 0xaf83, 0xab52, 0x0000, 0x0519, 0x0519, 0x8400, 0x8631, 0xaf83, 0xaf83, 0xaf83, 0x0519, 
+  0x8400, 0x3265, 0x0113, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x3301, 0x0150, 0x5b5a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 
+  0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0xf741, 0x0000, 
+  0xab52, 0x7294, 0x7294, 0x6d73, 0x8210, 0x0000, 0x8400, 0xec11, 0xec11, 0x8210, 0x8851, 0x7294, 0x7294, 0x3084, 0x8631, 0x0519, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0519, 0x8400, 0x3084, 0x7294, 0x7294, 0x6d73, 0x0000, 0x8631, 
+  0xec11, 0x0519, 0x8631, 0x3084, 0x7294, 0x7294, 0x8631, 0x0519, 0x3363, 0x0315, 0x7243, 0x7243, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x3084, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0xf58c, 
+  0x7ee7, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7ee7, 0x55a5, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7243, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7243, 
+  0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3400, 0x0151, 0x0e0a, 0x0e0a, 0xd021, 0x5b5a, 0x3f6a, 
+  0x1f72, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x1f72, 0x3f6a, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0x5b5a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x3f6a, 0xd021, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0519, 0xec09, 0x0e0a, 0xec11, 0x8210, 0x0000, 0x0000, 
+  0x0000, 0x8400, 0xec11, 0xec09, 0x0e0a, 0x0e0a, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x8400, 0x0000, 
+  0x0000, 0x0000, 0x8210, 0xec11, 0xec09, 0xec09, 0xec11, 0x8210, 0x0000, 0x8210, 0x0519, 0xec11, 0x3500, 0x0150, 0x4e12, 0x0e0a, 
+  0x0e0a, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 
+  0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0xec11, 0x8631, 0xec11, 0xec11, 0xec11, 0xec11, 0xec09, 0x0e0a, 0x0e0a, 0xec09, 
+  0xec09, 0xec11, 0xec11, 0xec11, 0xec11, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0xec09, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec11, 0x8631, 0xec11, 0xec09, 0x3625, 0x010f, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x363f, 
+  0x0111, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x3665, 0x0113, 0x4e12, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7243, 0x4e12, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3764, 0x0114, 0x4e12, 0x55a5, 0x7ac6, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 
+  0x0e0a, 0xf58c, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3865, 0x0113, 0x4e12, 
+  0x7243, 0x0e0a, 0x7243, 0x7ac6, 0xf58c, 0x0e0a, 0xd021, 0x7243, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x4e12, 0x3968, 0x0103, 0x7243, 0x7ac6, 0xf58c, 0x3976, 0x0102, 0x0e0a, 0x4e12, 0x423a, 0x0102, 0x0e0a, 0x0e0a, 0x4339, 
+  0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4430, 0x010d, 0xf58c, 0x3084, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x452e, 0x0112, 0x4e12, 0x4e12, 0x7ac6, 0x55a5, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x462d, 0x0113, 0x4e12, 0x7ac6, 0x7ac6, 0x4e12, 0xf58c, 0x7ac6, 
+  0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x472e, 0x0112, 0x7243, 
+  0x7294, 0x55a5, 0x55a5, 0x7294, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x4830, 0x0110, 0x7ac6, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x4930, 0x010d, 0x7243, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x4a39, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a
 };
-// 'frame_2_delay-0', 120x76px
-const uint16_t symbolNian3 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xe77e, 0xa555, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xc67a, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x4c37, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0xa555, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x4372, 0xc67a, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xe77e, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x4372, 0xa555, 0x9472, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0xc67a, 0xc67a, 
-  0x11ec, 0x124e, 0xbdb5, 0x8cf5, 0x0a0e, 0x8430, 0xc67a, 0xc67a, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0xc67a, 0xc67a, 0x11ec, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x8cf5, 0xc67a, 0xc67a, 
-  0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x124e, 
-  0x0a0e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xa555, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x4372, 0xe77e, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xe77e, 0xa555, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x3186, 0x1905, 
-  0x1905, 0x3186, 0x83af, 0x52ab, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x52ab, 0x52ab, 0x52ab, 0x5188, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x52ab, 0x5188, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x5188, 0xc534, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xa555, 0x1905, 0x3186, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x5188, 0x736d, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfe95, 0xfe95, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x11ec, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xf49c, 0x736d, 0x1905, 0x1905, 0x52ab, 0xf49c, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x1082, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x8430, 0x736d, 0x736d, 0x736d, 0x736d, 0x83af, 0x9472, 0xf49c, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x0000, 0x11ec, 0x11ec, 0x1905, 0x3186, 0x736d, 0x736d, 0x736d, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xfd41, 0xfd41, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xa555, 
-  0x0084, 0x8430, 0xa555, 0xa555, 0x9472, 0x3186, 0x736d, 0xc534, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x1082, 0x1905, 
-  0x3186, 0x3186, 0x52ab, 0xa555, 0xa555, 0x9472, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xa555, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x8430, 0x1082, 
-  0xc534, 0xfd1f, 0xfd1f, 0xfd1f, 0xfeda, 0x736d, 0x0000, 0x0000, 0x3186, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x7b98, 
-  0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x8bac, 0x3186, 0x0000, 0x736d, 
-  0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xc534, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0x5188, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x67c0, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 
-  0x3fe1, 0x3fc1, 0x67c0, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fc1, 0x5fc2, 0x5e07, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x7b98, 
-  0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5fc2, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fc1, 0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 
-  0x3fe1, 0x372a, 0x2c67, 0x1082, 0x736d, 0xfe95, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xf49c, 0xc534, 0x83af, 0x52ab, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x52ab, 0x52ab, 
-  0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x5fc2, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fc1, 0x2c67, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x9472, 0x0084, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x2c67, 0x2c67, 0x3186, 0x1905, 
-  0x3186, 0x1082, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0xbdb5, 0xe77e, 0xa555, 0x1082, 
-  0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xbdb5, 0xe77e, 0xbdb5, 0x1082, 0x8430, 0xa555, 0xa555, 0x9472, 
-  0x0084, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 
-  0x372a, 0x372a, 0x372a, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x372a, 0x2c67, 0x2c67, 0x2c67, 0x52ab, 0x736d, 0x736d, 0x736d, 0x736d, 0x52ab, 0x52ab, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x0000, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x83af, 0x736d, 0x8cf5, 
-  0xa555, 0x9472, 0x736d, 0x0000, 0x8430, 0xa555, 0xa555, 0x9472, 0x1082, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x2c67, 0x1082, 0x1082, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0x9472, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x1905, 
-  0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x1905, 0x9472, 0x9472, 0x3186, 0x1905, 0x1905, 0x8430, 0xa555, 0xa555, 0x9472, 
-  0x1082, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x4372, 0x1082, 0x52ab, 0x9472, 0xa555, 0xa555, 0xa555, 0x8430, 0x3186, 0x3186, 0x3186, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x9472, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0xa555, 
-  0xa555, 0x9472, 0x9472, 0x9472, 0xc534, 0xdcf4, 0xdcf4, 0x9472, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x4c37, 0x0a0e, 0x52ab, 0x8430, 0x8430, 0x8430, 0x8430, 0x52ab, 
-  0x0000, 0x1905, 0x11ec, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xa555, 0x9472, 0x736d, 
-  0x9472, 0xa555, 0xa555, 0x9472, 0x736d, 0x9472, 0xa555, 0xa555, 0x8cf5, 0x83af, 0x83af, 0xa555, 0xdcf4, 0xdcf4, 0xdcf4, 0x9c4c, 
-  0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x4372, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x4372, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfeda, 
-  0xfdbb, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0xa555, 0x83af, 0x0000, 0x8430, 0x8cf5, 0xa555, 0x8430, 0x1082, 0x8430, 0x8cf5, 0xa555, 
-  0x9472, 0x1082, 0x5188, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x52de, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x5a5b, 0x41f7, 0x41f7, 0x41f7, 0x41f7, 0x41f7, 
-  0x41f7, 0x5a5b, 0x5a5b, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x9472, 0x3186, 0x9472, 0xbdb5, 0xa555, 0xa555, 0xa555, 0x8430, 0x0000, 
-  0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x5188, 0xa555, 0xc534, 0xa555, 0x5188, 0x3186, 
-  0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x52de, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x6a3f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x5a5b, 0x1905, 0x5188, 0x9472, 0xdcf4, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xdcf4, 
-  0x736d, 0x736d, 0x83af, 0xa555, 0xa555, 0xa555, 0x9472, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x736d, 0xa555, 0x83af, 0x736d, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x6a3f, 0x5a5b, 0x1905, 0x0000, 0x1905, 0xa555, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0x52ab, 0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0084, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x5a5b, 0x1905, 0x3186, 0x83af, 0x736d, 0x736d, 
-  0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x8bac, 0x736d, 0x8bac, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 
-  0x736d, 0x3186, 0x0000, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x41f7, 0x1905, 0x52ab, 0xa555, 0x52ab, 0x3186, 0x0000, 0x0000, 0x1082, 0x1082, 0x0000, 0x1905, 0x3186, 0x3186, 
-  0x1905, 0x0000, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x1082, 0x0000, 0x1905, 0x3186, 
-  0x3186, 0x3186, 0x3186, 0x1905, 0x52ab, 0x3186, 0x1905, 0x5188, 0x5188, 0x3186, 0x1905, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x5a5b, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 
-  0x41f7, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1082, 0x52ab, 0xa555, 0x9472, 0x9472, 
-  0x1082, 0x0084, 0x11ec, 0x11ec, 0x0084, 0x8430, 0x8cf5, 0x8cf5, 0x83af, 0x1082, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x11ec, 0x0084, 0x736d, 0x8cf5, 0x8cf5, 0x9472, 0x3186, 0x52ab, 0xc67a, 0x736d, 0x0084, 0x9472, 
-  0xa555, 0xa555, 0x52ab, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x41f7, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0084, 0x1082, 0x3186, 0x3186, 0x3186, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x11ec, 0x3186, 0x3186, 0x3186, 
-  0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x3186, 0x3186, 
-  0x3186, 0x3186, 0x1082, 0x3186, 0x4372, 0x124e, 0x11ec, 0x3186, 0x3186, 0x3186, 0x1082, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x1082, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x09ec, 
-  0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xa555, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 
-  0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8430, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8430, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0x8cf5, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 
-  0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xe77e, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+// 'frame_2_delay-0', 120x76px, changes from frame 1
+const uint16_t symbolNianDelta3 [] PROGMEM = {
+  0x004f, 0x000b, 0x020d, 0xd021, 0x7ee7, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7ac6, 0x7ac6, 
+  0x4e12, 0xf58c, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7243, 0x374c, 0x002a, 0x020e, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0230, 0x0102, 0x0e0a, 0x0e0a, 0x0311, 
+  0x0102, 0x4e12, 0x4e12, 0x0330, 0x0303, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0410, 0x0204, 
+  0x4e12, 0x55a5, 0xf58c, 0x4e12, 0x4e12, 0x7ac6, 0x55a5, 0x4e12, 0x0611, 0x0101, 0x4e12, 0x0630, 0x0102, 0x0e0a, 0x0e0a, 0x0d31, 
+  0x0403, 0x4e12, 0xf58c, 0x7243, 0x7243, 0x7ac6, 0x55a5, 0x7243, 0x7ee7, 0x55a5, 0x7243, 0x55a5, 0x7294, 0x1049, 0x0203, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x122c, 0x010d, 0x7243, 0x7ac6, 0x7ac6, 0x7ac6, 0xec11, 0x4e12, 0xb5bd, 0xf58c, 0x0e0a, 
+  0x3084, 0x7ac6, 0x7ac6, 0x55a5, 0x1248, 0x0206, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x132c, 0x010e, 0x7243, 0x7ac6, 0x7ac6, 0x7ac6, 0xec11, 0x7243, 0x7ac6, 0xf58c, 0x0e0a, 0xf58c, 0x7ac6, 0x7ac6, 
+  0x55a5, 0x4e12, 0x142c, 0x010d, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 
+  0x4e12, 0x1449, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1531, 0x0103, 0xd021, 0x55a5, 0xf58c, 0x1549, 0x0103, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x162e, 0x021e, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7ee7, 0x55a5, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7ee7, 0x55a5, 0xec09, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1800, 
+  0x014e, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x8851, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x8631, 
+  0x0519, 0x0519, 0x8631, 0xaf83, 0xab52, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 
+  0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x8631, 0x0e0a, 0x0e0a, 0x1900, 
+  0x0150, 0x8851, 0x0689, 0x0689, 0x0689, 0x0689, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0xab52, 
+  0xab52, 0xab52, 0x8851, 0x8851, 0x8851, 0xab52, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 
+  0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0xab52, 0x8851, 0xec11, 0xec09, 0x0e0a, 
+  0x0e0a, 0x1a00, 0x0101, 0x23e3, 0x1a2a, 0x0126, 0xa2e8, 0xa2e8, 0x23e3, 0x8851, 0x34c5, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0xf4dc, 0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x55a5, 0x0519, 0x8631, 0xec09, 0x0e0a, 0x1b2b, 0x0125, 0x8851, 0x6d73, 
+  0x34c5, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x34c5, 
+  0xab52, 0x0519, 0xec09, 0x1c2f, 0x011f, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0xab52, 0x1d00, 0x014e, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x23e3, 0x0519, 0x6d73, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0xb7ea, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x95fe, 0x95fe, 0x95fe, 0x6d73, 0x1e00, 0x0130, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x23e3, 0x0519, 0x6d73, 0x95fe, 0xbbfd, 0xbbfd, 0x1e3a, 0x011b, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0xab52, 0x0000, 0xec11, 0xec09, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x1f31, 0x0103, 0x9cf4, 0xb7ea, 0xb7ea, 0x1f3d, 0x0118, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 
+  0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x6d73, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0xec11, 0xec11, 0x2032, 0x0101, 0x9cf4, 0x203d, 0x0119, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x6d73, 0x0519, 0x0519, 0xab52, 0x9cf4, 
+  0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0xab52, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0xec11, 0x8210, 0x8210, 0x0519, 
+  0x2100, 0x012c, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8631, 0x2139, 0x011f, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xf4dc, 0x3084, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0xaf83, 0x7294, 0x9cf4, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x6d73, 0x0000, 0xec11, 0xec11, 0x0519, 0x8631, 0x6d73, 0x6d73, 0x6d73, 0x8631, 0x0519, 0x2200, 
+  0x012b, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x41fd, 
+  0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x2238, 0x0121, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x55a5, 0x8400, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x6d73, 0x34c5, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0xbbfd, 0x95fe, 0xab52, 0x8210, 0x0519, 0x8631, 0x8631, 0xab52, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x8210, 0xec11, 0x2320, 
+  0x010a, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x2339, 0x011f, 0xb7ea, 0x9cf4, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x55a5, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x8210, 0x34c5, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0xdafe, 0x6d73, 0x0000, 0x0000, 0x8631, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x2420, 0x0138, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8631, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x987b, 0x8210, 0x3084, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0xac8b, 0x8631, 0x0000, 0x6d73, 0x3084, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x2500, 0x0158, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x40df, 0x40df, 
+  0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 
+  0x40df, 0x40df, 0x40df, 0x8631, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x34c5, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x8851, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 
+  0x2600, 0x0155, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0xc067, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xe13f, 0xe13f, 0xc13f, 0xc067, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x40df, 0xc25f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xe13f, 0xe13f, 0xc13f, 0xc25f, 0x075e, 0x0519, 0x6d73, 0x95fe, 
+  0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x987b, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x7294, 0x55a5, 0x7294, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x2700, 0x015a, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc25f, 0xe13f, 
+  0xe13f, 0xe13f, 0xc13f, 0xc25f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc25f, 0xc067, 0xc067, 0xc067, 0xc067, 
+  0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 
+  0xc13f, 0xe13f, 0x2a37, 0x672c, 0x8210, 0x6d73, 0x95fe, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x9cf4, 0x34c5, 0xaf83, 0xab52, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0xab52, 
+  0xab52, 0x8631, 0xec11, 0x2824, 0x0136, 0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xc13f, 0x672c, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0xb7ea, 0x9cf4, 0x9cf4, 0x8631, 
+  0xab52, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8400, 0x8631, 0x2924, 0x010e, 0x672c, 0x672c, 0x8631, 
+  0x0519, 0x8631, 0x8210, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0xb7ea, 0xb7ea, 0x293b, 0x011f, 0x9cf4, 0x1ffd, 0x9cf4, 
+  0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xb5bd, 0x7ee7, 0x55a5, 0x8210, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0xb5bd, 0x7ee7, 0xb5bd, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8400, 0x8631, 0x2a00, 0x015a, 0xc25f, 0xe13f, 
+  0xe13f, 0xe13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 
+  0x2a37, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0x2a37, 0x672c, 
+  0x672c, 0x672c, 0xab52, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0xab52, 0xab52, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0xb7ea, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x0000, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0x6d73, 0xf58c, 0x55a5, 0x7294, 
+  0x6d73, 0x0000, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8210, 0x8631, 0x2b00, 0x012c, 0xc25f, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0x672c, 0x8210, 0x8210, 0x8631, 0x7294, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x0519, 0x2b37, 0x0123, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 
+  0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0519, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0x0519, 
+  0x7294, 0x7294, 0x8631, 0x0519, 0x0519, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8210, 0x8631, 0x2c00, 0x015a, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7243, 0x8210, 0xab52, 
+  0x7294, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x8631, 0x8631, 0x8631, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x34c5, 0xf4dc, 
+  0xf4dc, 0x34c5, 0x7294, 0x7294, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x55a5, 0x55a5, 0x7294, 0x7294, 
+  0x7294, 0x34c5, 0xf4dc, 0xf4dc, 0x7294, 0x0519, 0x8631, 0x2d20, 0x013a, 0x374c, 0x0e0a, 0xab52, 0x3084, 0x3084, 0x3084, 0x3084, 
+  0xab52, 0x0000, 0x0519, 0xec11, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0xbbfd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x55a5, 0x7294, 
+  0x6d73, 0x7294, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x7294, 0x55a5, 0x55a5, 0xf58c, 0xaf83, 0xaf83, 0x55a5, 0xf4dc, 0xf4dc, 0xf4dc, 
+  0x4c9c, 0x0519, 0xec11, 0x2e22, 0x0138, 0x7243, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x7243, 0x374c, 0x0519, 0x6d73, 
+  0x95fe, 0x95fe, 0xdafe, 0xbbfd, 0x9cf4, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x9cf4, 0x8631, 0xab52, 0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x55a5, 0xaf83, 0x0000, 0x3084, 0xf58c, 0x55a5, 0x3084, 0x8210, 
+  0x3084, 0xf58c, 0x55a5, 0x7294, 0x8210, 0x8851, 0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x0519, 0xec11, 0x2f00, 0x0159, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0xde52, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 
+  0x7f2c, 0x5b5a, 0xf741, 0xf741, 0xf741, 0xf741, 0xf741, 0xf741, 0x5b5a, 0x5b5a, 0x0519, 0x6d73, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 
+  0xbbfd, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xf4dc, 0x7294, 0x8631, 
+  0x7294, 0xb5bd, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x0000, 0x0519, 0x8631, 0x8631, 0x0519, 0x0000, 0x0519, 0x8631, 0x8631, 0x0519, 
+  0x0000, 0x8851, 0x55a5, 0x34c5, 0x55a5, 0x8851, 0x8631, 0xec11, 0x2f68, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x3000, 0x0158, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x3f6a, 0x1f72, 0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x3f6a, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 
+  0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x5b5a, 0x0519, 0x8851, 0x7294, 0xf4dc, 0x95fe, 0x95fe, 
+  0x95fe, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xf4dc, 0x6d73, 
+  0x6d73, 0xaf83, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 
+  0xab52, 0x6d73, 0x55a5, 0xaf83, 0x6d73, 0x8631, 0x0519, 0x3065, 0x010a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x3125, 0x0132, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x0519, 0x0000, 0x0519, 0x55a5, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0xf4dc, 0xab52, 0x8400, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x8400, 0xec09, 0x3164, 0x010b, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3225, 0x0131, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x5b5a, 0x0519, 0x8631, 0xaf83, 0x6d73, 
+  0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0xac8b, 0x6d73, 0xac8b, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 
+  0x6d73, 0x6d73, 0x8631, 0x0000, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 
+  0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0x8631, 0xec11, 0x3265, 0x0109, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x3301, 0x0154, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 
+  0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0xf741, 0x0519, 0xab52, 
+  0x55a5, 0xab52, 0x8631, 0x0000, 0x0000, 0x8210, 0x8210, 0x0000, 0x0519, 0x8631, 0x8631, 0x0519, 0x0000, 0x8400, 0x8400, 0x8400, 
+  0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8210, 0x0000, 0x0519, 0x8631, 0x8631, 0x8631, 0x8631, 0x0519, 0xab52, 
+  0x8631, 0x0519, 0x8851, 0x8851, 0x8631, 0x0519, 0x8210, 0xec11, 0x3363, 0x030d, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x3400, 0x0255, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x5b5a, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 
+  0x3f6a, 0x3f6a, 0x3f6a, 0xf741, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x8210, 0xab52, 
+  0x55a5, 0x7294, 0x7294, 0x8210, 0x8400, 0xec11, 0xec11, 0x8400, 0x3084, 0xf58c, 0xf58c, 0xaf83, 0x8210, 0xec11, 0xec09, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec09, 0xec11, 0x8400, 0x6d73, 0xf58c, 0xf58c, 0x7294, 0x8631, 0xab52, 0x7ac6, 
+  0x6d73, 0x8400, 0x7294, 0x55a5, 0x55a5, 0xab52, 0x8210, 0xec11, 0xf741, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 
+  0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x8400, 0x8210, 0x8631, 0x8631, 0x8631, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0xec11, 0x8631, 0x8631, 0x8631, 
+  0x8631, 0x0000, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x8631, 0x8631, 
+  0x8631, 0x8631, 0x8210, 0x8631, 0x7243, 0x4e12, 0xec11, 0x8631, 0x8631, 0x8631, 0x8210, 0x0000, 0xec11, 0x362b, 0x0110, 0x0519, 
+  0x0519, 0x0519, 0x0519, 0x0519, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0519, 0x8210, 0x0519, 0x0519, 0x0519, 0xec11, 0x3646, 
+  0x010f, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0e0a, 0x0e0a, 0x0e0a, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 
+  0x3665, 0x010a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x372c, 0x010e, 0x0e0a, 0xec09, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0x3764, 0x010b, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3800, 0x0101, 0x0e0a, 0x3865, 0x010a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3968, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x411e, 0x0303, 0xd021, 
+  0x55a5, 0xf58c, 0x7243, 0x7ac6, 0x55a5, 0x4e12, 0x3084, 0x7243, 0x4430, 0x0102, 0x0e0a, 0x0e0a, 0x451a, 0x0101, 0x4e12, 0x4524, 
+  0x0110, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x4619, 0x021b, 0x3084, 0x7ac6, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7ac6, 0x7ac6, 
+  0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7ac6, 
+  0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7ac6, 0xf58c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4819, 0x0102, 0x4e12, 0x4e12, 0x4824, 0x0102, 0x4e12, 
+  0x4e12, 0x4830, 0x0202, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4a1e, 0x0103, 0x4e12, 0xf58c, 0x7243, 0x4b1e, 0x0104, 0x7243, 0x7ee7, 
+  0x7ac6, 0x4e12
 };
-// 'frame_3_delay-0', 120x76px
-const uint16_t symbolNian4 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xe77e, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x8cf5, 
-  0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8430, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x124e, 0xc67a, 0xc67a, 0x21d0, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x4c37, 0x124e, 0x4372, 0x83af, 0x0a0e, 0x4372, 0xc67a, 0x4372, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xa555, 
-  0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 0xa555, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x8cf5, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 
-  0xa555, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xa555, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x4372, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 
-  0x4372, 0x124e, 0x83af, 0x8430, 0x124e, 0x4372, 0xa555, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xe77e, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x5188, 0x8906, 0xe323, 0xdcf4, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x3186, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x52ab, 0x52ab, 0x52ab, 0x5188, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x52ab, 0x52ab, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x52ab, 0x5188, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x5188, 0xc534, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xa555, 0x1905, 0x3186, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x5188, 0x736d, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfdbb, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfe95, 0xfe95, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x11ec, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xf49c, 0x736d, 0x1905, 0x1905, 0x52ab, 0xf49c, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x1082, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x9472, 0x736d, 0x736d, 0x736d, 0x736d, 0x83af, 0x9472, 0xf49c, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x0000, 0x11ec, 0x11ec, 0x1905, 0x3186, 0x736d, 0x736d, 0x736d, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xfd41, 0xfd41, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xa555, 
-  0x0084, 0x8430, 0xa555, 0xa555, 0x9472, 0x3186, 0x736d, 0xc534, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x1082, 0x1905, 
-  0x3186, 0x3186, 0x52ab, 0xa555, 0xa555, 0x9472, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xa555, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x8430, 0x1082, 
-  0xc534, 0xfd1f, 0xfd1f, 0xfd1f, 0xfeda, 0x736d, 0x0000, 0x0000, 0x3186, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x7b98, 
-  0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x8bac, 0x3186, 0x0000, 0x736d, 
-  0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xc534, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0x5188, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x67c0, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 
-  0x3fe1, 0x3fc1, 0x67c0, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x5fc2, 0x5fc2, 0x5e07, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x7b98, 
-  0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5fc2, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fc1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 
-  0x25d0, 0x25d0, 0x2c67, 0x1082, 0x736d, 0xfe95, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xf49c, 0xc534, 0x83af, 0x52ab, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x52ab, 0x52ab, 
-  0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x5fc2, 0x3fe1, 0x3fc1, 0x3fe1, 0x2c67, 0x1082, 0x0000, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x9472, 0x0084, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x2c67, 0x2c67, 0x2c67, 0x52ab, 
-  0x8430, 0x8430, 0x83af, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0xbdb5, 0xe77e, 0xa555, 0x1082, 
-  0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xbdb5, 0xe77e, 0xbdb5, 0x1082, 0x8430, 0xa555, 0xa555, 0x9472, 
-  0x0084, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 
-  0x372a, 0x372a, 0x372a, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x372a, 0x25d0, 0x2c67, 0x52ab, 0x736d, 0x736d, 0x8430, 0xa555, 0xa555, 0x9472, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x0000, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x83af, 0x736d, 0x8cf5, 
-  0xa555, 0x9472, 0x736d, 0x0000, 0x8430, 0xa555, 0xa555, 0x9472, 0x1082, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x25d0, 0x4372, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x1905, 
-  0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x1905, 0x9472, 0x9472, 0x3186, 0x1905, 0x1905, 0x8430, 0xa555, 0xa555, 0x9472, 
-  0x1082, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x4c37, 0x11ec, 0x736d, 0x9472, 0xa555, 0x9472, 0x5188, 0x5188, 0x5188, 0x3186, 0x3186, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x9472, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0xa555, 
-  0xa555, 0x9472, 0x9472, 0x9472, 0xc534, 0xdcf4, 0xdcf4, 0x9472, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x4c37, 0x1082, 0x736d, 0xa555, 0xa555, 0x9472, 0x1082, 0x1905, 
-  0x09ec, 0x09ec, 0x11ec, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xa555, 0x9472, 0x736d, 
-  0x9472, 0xa555, 0xa555, 0x9472, 0x736d, 0x9472, 0xa555, 0xa555, 0x8cf5, 0x83af, 0x83af, 0xa555, 0xdcf4, 0xdcf4, 0xdcf4, 0x9c4c, 
-  0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x4c37, 0x1082, 0x736d, 0xa555, 0xa555, 0x9472, 0x1082, 0x21d0, 0x2c7f, 0x155f, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfeda, 
-  0xfdbb, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0xa555, 0x83af, 0x0000, 0x8430, 0x8cf5, 0xa555, 0x8430, 0x1082, 0x8430, 0x8cf5, 0xa555, 
-  0x9472, 0x1082, 0x5188, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x41f7, 0x21d0, 0x5188, 0x5188, 0x11ec, 0x41f7, 0x5a5b, 
-  0x2c7f, 0x2c7f, 0x5a5b, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x9472, 0x3186, 0x9472, 0xbdb5, 0xa555, 0xbdb5, 0xa555, 0x8430, 0x0000, 
-  0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x5188, 0xa555, 0xc534, 0xa555, 0x5188, 0x3186, 
-  0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x52de, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x6a3f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x41f7, 0x21d0, 0x21d0, 0x41f7, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x5a5b, 0x1905, 0x5188, 0x9472, 0xdcf4, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xdcf4, 
-  0x736d, 0x736d, 0x83af, 0xa555, 0xa555, 0xa555, 0x9472, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x736d, 0xa555, 0x83af, 0x736d, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 
-  0x721f, 0x6a3f, 0x41f7, 0x1905, 0x1082, 0x1905, 0xa555, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0x52ab, 0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0084, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x41f7, 0x11ec, 0x736d, 0x83af, 0x83af, 0x736d, 0x736d, 
-  0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x8bac, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 
-  0x736d, 0x3186, 0x0000, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x1905, 0x1905, 0xa555, 0xa555, 0xa555, 0x52ab, 0x0000, 0x1082, 0x1082, 0x0000, 0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 
-  0x0000, 0x0084, 0x0084, 0x0084, 0x5188, 0x52ab, 0x52ab, 0x3186, 0x0084, 0x3186, 0x5188, 0x1082, 0x1082, 0x3186, 0x3186, 0x3186, 
-  0x1082, 0x0000, 0x0084, 0x1082, 0x0084, 0x3186, 0x52ab, 0x3186, 0x1905, 0x1082, 0x0084, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x5a5b, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 
-  0x41f7, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0084, 0x1905, 0x9472, 0x8cf5, 0x9472, 0x52ab, 0x0000, 
-  0x3186, 0x11ec, 0x0084, 0x736d, 0xa555, 0x8cf5, 0x9472, 0x1905, 0x1905, 0x09ec, 0x09ec, 0x09ec, 0xc67a, 0xe77e, 0xe77e, 0x8cf5, 
-  0x11ec, 0xc67a, 0xc67a, 0x3186, 0x52ab, 0x8cf5, 0x8cf5, 0x8cf5, 0x1905, 0x1082, 0x11ec, 0x1905, 0x1082, 0x8430, 0xa555, 0xa555, 
-  0x736d, 0x1082, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x41f7, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0084, 0x0000, 0x3186, 0x3186, 0x3186, 0x3186, 0x11ec, 0x0a0e, 0x09ec, 0x11ec, 0x3186, 0x3186, 0x3186, 0x3186, 0x0000, 
-  0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x4372, 0x4372, 0xa555, 0xc67a, 0x8430, 0x4372, 0x11ec, 0x3186, 0x3186, 0x3186, 0x3186, 
-  0x0000, 0x1082, 0x11ec, 0x09ec, 0x11ec, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1082, 0x1905, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 
-  0xe77e, 0x4372, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x09ec, 0x09ec, 0x09ec, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x09ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 0xe77e, 0x83af, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4c37, 
-  0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 
-  0x124e, 0xc67a, 0xc67a, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x4372, 0x124e, 0x4372, 0x4372, 0x0a0e, 0x4372, 0xa555, 0x4372, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8cf5, 0x4372, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8cf5, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0xc67a, 0xc67a, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0xc67a, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x4372, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x4372, 
-  0x124e, 0x4372, 0x4372, 0x124e, 0x4372, 0x8cf5, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+// 'frame_3_delay-0', 120x76px, changes from frame 2
+const uint16_t symbolNianDelta4 [] PROGMEM = {
+  0x003a, 0x0006, 0x0212, 0x7243, 0x7ee7, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xf58c, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0311, 0x0102, 0x0e0a, 0x0e0a, 0x0410, 0x0204, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0611, 0x0101, 0x0e0a, 0x0d22, 0x0102, 0x7243, 0x3084, 0x0d31, 0x0403, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e1f, 0x0109, 0x4e12, 0x0e0a, 0x4e12, 0x7ac6, 
+  0x7ac6, 0xd021, 0x0e0a, 0x4e12, 0x4e12, 0x0f1e, 0x020a, 0x7243, 0x7ac6, 0x374c, 0x4e12, 0x7243, 0xaf83, 0x0e0a, 0x7243, 0x7ac6, 
+  0x7243, 0xd021, 0x55a5, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0xf58c, 0x7243, 0x121c, 0x011d, 0x4e12, 0x55a5, 0x55a5, 
+  0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xf58c, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x131c, 0x011e, 0x4e12, 0x55a5, 0x55a5, 0x4e12, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xf58c, 0x55a5, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x141d, 0x011c, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x151e, 0x020a, 0xd021, 0x55a5, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x7243, 0x55a5, 0x7243, 0x7243, 0x7ac6, 0x7243, 0x4e12, 0xaf83, 0x3084, 0x4e12, 0x7243, 0x55a5, 0x7243, 0x1531, 0x0203, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1721, 0x0104, 0x4e12, 0x7ac6, 0x7ee7, 0xd021, 0x1731, 0x0104, 0xec09, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x1822, 0x0102, 0x23e3, 0xf4dc, 0x1831, 0x0103, 0x0519, 0x0519, 0x0519, 0x193e, 0x0105, 0xab52, 0xab52, 0x8851, 
+  0x8851, 0xab52, 0x1a42, 0x0101, 0xf4dc, 0x1b35, 0x0101, 0xbbfd, 0x1b41, 0x0101, 0xbbfd, 0x2140, 0x0101, 0x7294, 0x2628, 0x0101, 
+  0xc25f, 0x270a, 0x0101, 0xe13f, 0x2727, 0x0203, 0x2a37, 0xd025, 0xd025, 0x672c, 0x8210, 0x0000, 0x2926, 0x0106, 0x672c, 0xab52, 
+  0x3084, 0x3084, 0xaf83, 0x8210, 0x2a20, 0x010b, 0xc13f, 0x2a37, 0xd025, 0x672c, 0xab52, 0x6d73, 0x6d73, 0x3084, 0x55a5, 0x55a5, 
+  0x7294, 0x2b20, 0x010a, 0x2a37, 0xd025, 0x7243, 0x8631, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x2c20, 0x0109, 0x374c, 
+  0xec11, 0x6d73, 0x7294, 0x55a5, 0x7294, 0x8851, 0x8851, 0x8851, 0x2d21, 0x010b, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x8210, 
+  0x0519, 0xec09, 0xec09, 0xec11, 0x0000, 0x2d37, 0x0101, 0xb7ea, 0x2e20, 0x010a, 0x374c, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x7294, 
+  0x8210, 0xd021, 0x7f2c, 0x5f15, 0x2e41, 0x0101, 0xf4dc, 0x2f05, 0x0101, 0x7f2c, 0x2f21, 0x0109, 0xf741, 0xd021, 0x8851, 0x8851, 
+  0xec11, 0xf741, 0x5b5a, 0x7f2c, 0x7f2c, 0x2f44, 0x0101, 0xb5bd, 0x3022, 0x0105, 0xf741, 0xd021, 0xd021, 0xf741, 0x3f6a, 0x3123, 
+  0x010a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0xf741, 0x0519, 0x8210, 0x3228, 0x0105, 0x3f6a, 0xf741, 0xec11, 
+  0x6d73, 0xaf83, 0x3238, 0x0101, 0x6d73, 0x3329, 0x012b, 0x0519, 0x0519, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0x0000, 0x8210, 0x8210, 
+  0x0000, 0x0519, 0x8631, 0x8631, 0x0519, 0x0000, 0x0000, 0x8400, 0x8400, 0x8400, 0x8851, 0xab52, 0xab52, 0x8631, 0x8400, 0x8631, 
+  0x8851, 0x8210, 0x8210, 0x8631, 0x8631, 0x8631, 0x8210, 0x0000, 0x8400, 0x8210, 0x8400, 0x8631, 0xab52, 0x8631, 0x0519, 0x8210, 
+  0x8400, 0x0519, 0x3429, 0x032c, 0x8400, 0x0519, 0x7294, 0xf58c, 0x7294, 0xab52, 0x0000, 0x8631, 0xec11, 0x8400, 0x6d73, 0x55a5, 
+  0xf58c, 0x7294, 0x0519, 0x0519, 0xec09, 0xec09, 0xec09, 0x7ac6, 0x7ee7, 0x7ee7, 0xf58c, 0xec11, 0x7ac6, 0x7ac6, 0x8631, 0xab52, 
+  0xf58c, 0xf58c, 0xf58c, 0x0519, 0x8210, 0xec11, 0x0519, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x6d73, 0x8210, 0x0519, 0x0e0a, 0x0e0a, 
+  0x8400, 0x0000, 0x8631, 0x8631, 0x8631, 0x8631, 0xec11, 0x0e0a, 0xec09, 0xec11, 0x8631, 0x8631, 0x8631, 0x8631, 0x0000, 0x0519, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7243, 0x7243, 0x55a5, 0x7ac6, 0x3084, 0x7243, 0xec11, 0x8631, 0x8631, 0x8631, 0x8631, 0x0000, 
+  0x8210, 0xec11, 0xec09, 0xec11, 0x8631, 0x8631, 0x8631, 0x0519, 0x0000, 0xec11, 0x0e0a, 0x0e0a, 0x0519, 0x0519, 0x0519, 0x0519, 
+  0x0519, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x0519, 0x8210, 0x0519, 0x0519, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x55a5, 0x7ee7, 0x7243, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 
+  0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0x3729, 0x0103, 0xec09, 0xec09, 0xec09, 0x3739, 0x0109, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x55a5, 0x7ee7, 0xaf83, 0x383f, 0x0103, 0x374c, 0xf58c, 0x7243, 0x4110, 0x0104, 0x4e12, 
+  0xf58c, 0xf58c, 0x4e12, 0x411e, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x420d, 0x0214, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 0x7ac6, 0x7ac6, 
+  0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7ac6, 
+  0x7243, 0x4e12, 0x7243, 0x7243, 0x0e0a, 0x7243, 0x55a5, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x440d, 0x010a, 0x7243, 0xf58c, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0xf58c, 0xd021, 0x450c, 0x010f, 
+  0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x4524, 
+  0x0102, 0x0e0a, 0x0e0a, 0x460b, 0x021c, 0xd021, 0x7ac6, 0x7ac6, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 
+  0x7ac6, 0x7ac6, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x4e12, 0x7ac6, 0xf58c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0xf58c, 0x7ac6, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x480c, 0x010f, 0x4e12, 
+  0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x4824, 0x0102, 
+  0x0e0a, 0x0e0a, 0x490d, 0x010a, 0x7243, 0x55a5, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x55a5, 0x7243, 0x4a0d, 0x0114, 
+  0x7243, 0x55a5, 0x7243, 0x4e12, 0x7243, 0x7243, 0x4e12, 0x7243, 0xf58c, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4b10, 0x0104, 0x4e12, 0x7ac6, 0x7ac6, 0x4e12, 0x4b1e, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a
 };
-// 'frame_4_delay-0', 120x76px
-const uint16_t symbolNian5 [] PROGMEM = {
-  0x124e, 0xa555, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0x8cf5, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 
-  0xc67a, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x124e, 0x8430, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xe77e, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x8906, 0x8906, 0x8906, 0x5188, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x11ec, 0x8906, 0x8906, 0xdcf4, 0xe323, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x5188, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x3186, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x5188, 0x11ec, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x52ab, 0x5188, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x8906, 0x3186, 0xc534, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0xdcf4, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 
-  0xfe95, 0xdcf4, 0xdcf4, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xa555, 0x1905, 0x11ec, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x5188, 0x736d, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfdbb, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfe95, 0xfe95, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfc82, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x11ec, 0x11ec, 0x11ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x9472, 
-  0x1905, 0x1905, 0x3186, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x11ec, 0x0084, 0x1082, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xce06, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x9472, 0x83af, 0x83af, 0x736d, 0x736d, 0x83af, 0xc534, 0xf49c, 0xf49c, 0xf49c, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x736d, 0x0000, 0x1905, 0x3186, 0x736d, 0x736d, 0x83af, 0x3186, 0x1905, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xfd41, 0xfd41, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0x52ab, 0x52ab, 0xc534, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x1082, 0x3186, 
-  0x52ab, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x9472, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfeda, 0x736d, 0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xce06, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0xce06, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x8bac, 0x736d, 0x83af, 0x8cf5, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xce06, 0x9c4c, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x0000, 0x52ab, 
-  0xce06, 0xce06, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x736d, 0x3186, 
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x67c0, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x67c0, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5e07, 0x3186, 
-  0x52ab, 0x9472, 0xa555, 0xa555, 0xa555, 0x8430, 0x1905, 0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x5fc2, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x5e07, 0x1905, 0x1905, 0x52ab, 0x9472, 0xa555, 0xa555, 0xa555, 0x8430, 0x8430, 
-  0x83af, 0x1905, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xc534, 0x9472, 0x52ab, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x736d, 0x52ab, 0x3186, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5e07, 0x1905, 
-  0x1082, 0x1082, 0x83af, 0x8cf5, 0x8cf5, 0xa555, 0xa555, 0x9472, 0x9472, 0x3186, 0x1082, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x372a, 0x372a, 0x5e07, 0x2c67, 0x0084, 0x1082, 0x1082, 0x1082, 0x1082, 
-  0x1905, 0x9472, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 0xc67a, 0x3186, 0x736d, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 0xc67a, 0x3186, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x372a, 0x372a, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x3fc1, 0x3fe1, 
-  0x3fc1, 0x3fc1, 0x5e07, 0x5e07, 0x5e07, 0x5e07, 0x5e07, 0x2c67, 0x1082, 0x52ab, 0x52ab, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x8430, 0x1082, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0x8430, 0x736d, 0x9472, 0xa555, 0x9472, 
-  0x8430, 0x1082, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x157c, 0x157c, 0x157c, 0x372a, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x3fc1, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x372a, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x2c67, 
-  0x1905, 0x1905, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x1905, 0x83af, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x736d, 0x1905, 0x8430, 0x8cf5, 0x3186, 0x1905, 0x1082, 0x736d, 0xbdb5, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x4c37, 0x4c37, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0x9472, 0x9472, 0x9472, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0xa555, 0xa555, 0x9472, 
-  0x9472, 0x9472, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x157c, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x8cf5, 0x83af, 0x9472, 0xa555, 
-  0xa555, 0x8cf5, 0x83af, 0x9472, 0xa555, 0xa555, 0xa555, 0x83af, 0x83af, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfeda, 
-  0xfdbb, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x9472, 0xc534, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x1082, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x736d, 0xa555, 0x8cf5, 0x8cf5, 0x3186, 
-  0x3186, 0x9472, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x5188, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x21d0, 0x124e, 0x0084, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xc534, 0x3186, 0x83af, 0xc534, 0xbdb5, 0xbdb5, 0xa555, 0x9472, 0x1082, 0x0084, 0x1905, 
-  0x1905, 0x3186, 0x1082, 0x1082, 0x3186, 0x3186, 0x3186, 0x0000, 0x3186, 0x9472, 0xa555, 0xbdb5, 0x52ab, 0x3186, 0x11ec, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x721f, 0x6a3f, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x52de, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x5a5b, 0x4372, 0x1905, 0x0000, 0x0000, 0x5188, 0x9472, 0xdcf4, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xdcf4, 0x8bac, 0x736d, 
-  0x83af, 0x9472, 0xa555, 0xa555, 0x8cf5, 0x736d, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x736d, 0x8cf5, 0x9472, 0x736d, 0x3186, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x41f7, 
-  0x0084, 0x0000, 0x0000, 0x0000, 0x0000, 0x1905, 0xa555, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x83af, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x5a5b, 0x21d0, 0x124e, 0x83af, 0x83af, 0x83af, 0x83af, 0x52ab, 0x1082, 0x52ab, 0x736d, 
-  0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x8bac, 0x736d, 0x8bac, 0x736d, 0x736d, 0x736d, 0x736d, 0x5188, 
-  0x0000, 0x5188, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x5a5b, 0x5a5b, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x41f7, 0x0084, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x83af, 0x52ab, 0x3186, 0x0000, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x3186, 0x5188, 0x52ab, 
-  0x3186, 0x1082, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x1082, 0x0000, 0x1905, 0x3186, 0x3186, 0x1905, 0x0000, 0x0000, 0x0084, 
-  0x0000, 0x0000, 0x3186, 0x3186, 0x3186, 0x1082, 0x1082, 0x0084, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x41f7, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x5a5b, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x52de, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x41f7, 0x0084, 0x52ab, 0xbdb5, 0xbdb5, 0x9472, 0x1905, 0x736d, 0xc67a, 0x9472, 0x0000, 
-  0x9472, 0xa555, 0xa555, 0x83af, 0x1082, 0x9472, 0xe77e, 0xe77e, 0xc67a, 0x11ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x11ec, 
-  0x0084, 0x8430, 0xa555, 0xa555, 0x9472, 0x1082, 0x1905, 0x3186, 0x0084, 0x1905, 0x9472, 0xa555, 0xa555, 0x52ab, 0x0084, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x1082, 0x3186, 
-  0x736d, 0x736d, 0x52ab, 0x1905, 0x11ec, 0x736d, 0x124e, 0x1905, 0x52ab, 0x736d, 0x736d, 0x52ab, 0x0000, 0x124e, 0x4372, 0x4372, 
-  0x4372, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x52ab, 0x736d, 0x736d, 0x52ab, 0x1082, 0x1905, 0x09ec, 
-  0x11ec, 0x11ec, 0x736d, 0x736d, 0x736d, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x0084, 0x1905, 0x1905, 0x1905, 0x1905, 0x09ec, 0x0a0e, 0x09ec, 0x09ec, 0x0a0e, 
-  0x1905, 0x1905, 0x52ab, 0x5188, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x0084, 0x0084, 0x1905, 0x1905, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x09ec, 0x09ec, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x4372, 0xc67a, 0xa555, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x4372, 0xe77e, 0xa555, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0x8cf5, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0xe77e, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0xc67a, 0xe77e, 0x21d0, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xc67a, 0x4372, 0x124e, 0xc67a, 0xc67a, 0x124e, 0x83af, 0xc67a, 0xc67a, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xc67a, 0x4372, 0x124e, 0xa555, 0xa555, 0x124e, 0x4372, 0xc67a, 
-  0xc67a, 0xc67a, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0xa555, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x124e, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x21d0, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+// 'frame_4_delay-0', 120x76px, changes from frame 3
+const uint16_t symbolNianDelta5 [] PROGMEM = {
+  0x004e, 0x0001, 0x0108, 0x55a5, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0100, 0x0109, 0x7ac6, 0xf58c, 0x4e12, 
+  0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0200, 0x0102, 0x7ac6, 0x7243, 0x0d12, 0x0303, 0xd021, 0xf58c, 0x7243, 0x7243, 
+  0x7ac6, 0x55a5, 0x4e12, 0x7243, 0x7243, 0x0d22, 0x0102, 0x0e0a, 0x0e0a, 0x0e1f, 0x0109, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0f1e, 0x020a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x120d, 0x021d, 0x7243, 0x7ac6, 0xf58c, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7ac6, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x7ac6, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0x7ac6, 0xf58c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x140d, 0x011c, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x151e, 0x020a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1612, 0x0103, 0x4e12, 0x3084, 0x7243, 0x1712, 
+  0x0104, 0x7243, 0x7ee7, 0x7ac6, 0x4e12, 0x1721, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1800, 0x012e, 0x0689, 0x0689, 0x0689, 
+  0x8851, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0689, 0x0689, 
+  0xf4dc, 0x23e3, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x8851, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1900, 0x0130, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x23e3, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x8851, 0xec11, 0x8851, 0x8851, 0x1939, 0x0107, 0xab52, 
+  0x8851, 0x8851, 0x8851, 0x8851, 0xab52, 0x8851, 0x194d, 0x0201, 0x0e0a, 0xec11, 0x1a00, 0x0101, 0xa2e8, 0x1a2b, 0x0103, 0x23e3, 
+  0x0689, 0x8631, 0x1a37, 0x010d, 0x95fe, 0xf4dc, 0xf4dc, 0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xf4dc, 0x95fe, 0xf4dc, 0xf4dc, 
+  0xf4dc, 0x1b41, 0x0101, 0x1ffd, 0x1d00, 0x022c, 0x82fc, 0x82fc, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0x23e3, 0x8210, 0x41fd, 0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x23e3, 0x8210, 0x1f2a, 0x0102, 
+  0x82fc, 0x8631, 0x1f3f, 0x0106, 0x9cf4, 0xb7ea, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1f51, 0x0105, 0xec11, 0xec11, 0xec11, 0xec09, 
+  0xec09, 0x202b, 0x0101, 0x8631, 0x203f, 0x0107, 0x7294, 0x0519, 0x0519, 0x8631, 0x9cf4, 0x1ffd, 0x1ffd, 0x2050, 0x0107, 0xec11, 
+  0x8400, 0x8210, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x2100, 0x012c, 0x06ce, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x23e3, 0x0519, 0x213d, 0x011b, 0x9cf4, 0x7294, 0xaf83, 0xaf83, 0x6d73, 0x6d73, 0xaf83, 0x34c5, 0x9cf4, 0x9cf4, 
+  0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x95fe, 0x6d73, 0x0000, 0x0519, 0x8631, 0x6d73, 0x6d73, 0xaf83, 0x8631, 0x0519, 0xec09, 
+  0x0e0a, 0x2200, 0x012b, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x06ce, 0x223d, 0x011c, 
+  0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0xab52, 0x34c5, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 
+  0xab52, 0x8210, 0x8631, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x0e0a, 0x233d, 0x031b, 0x9cf4, 0x8631, 
+  0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x7294, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xdafe, 0x6d73, 0x8400, 
+  0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x8210, 0xec11, 0x0e0a, 0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0xf58c, 0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xac8b, 0x6d73, 0xaf83, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x8631, 0x8210, 0xec11, 0x0e0a, 0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x6d73, 0x8631, 0x8631, 
+  0x8631, 0x8631, 0x8631, 0x8631, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x2420, 
+  0x0108, 0x06ce, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0x06ce, 0x2500, 0x012b, 0x40df, 0x40df, 0x40df, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x40df, 0x40df, 0x40df, 
+  0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x06ce, 0x4c9c, 0x8631, 0x8631, 0x8631, 0x8631, 
+  0x8631, 0x0000, 0xab52, 0x06ce, 0x06ce, 0x06ce, 0x2600, 0x012c, 0xc25f, 0xc13f, 0xc067, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0xc067, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xe13f, 
+  0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0x075e, 0x8631, 0xab52, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x0519, 0x0519, 
+  0x8631, 0x8631, 0x0519, 0x0000, 0x263d, 0x010d, 0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x7294, 0x55a5, 0x55a5, 0x2654, 0x0104, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x2700, 0x012f, 0xc25f, 0xc25f, 0xc25f, 0xc067, 0xc067, 
+  0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xe13f, 0xc13f, 0xe13f, 0xc13f, 
+  0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xe13f, 0x075e, 0x0519, 0x0519, 0xab52, 0x7294, 0x55a5, 0x55a5, 
+  0x55a5, 0x3084, 0x3084, 0xaf83, 0x0519, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x273c, 0x0106, 0x34c5, 0x7294, 0xab52, 0x3084, 
+  0x55a5, 0x55a5, 0x2754, 0x0106, 0x6d73, 0xab52, 0x8631, 0xec11, 0x0e0a, 0x0e0a, 0x281e, 0x010d, 0x075e, 0x0519, 0x8210, 0x8210, 
+  0xaf83, 0xf58c, 0xf58c, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x8631, 0x8210, 0x283c, 0x010c, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x55a5, 0x55a5, 0x2851, 0x0109, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 
+  0x0e0a, 0x0e0a, 0x291f, 0x010d, 0x2a37, 0x2a37, 0x075e, 0x672c, 0x8400, 0x8210, 0x8210, 0x8210, 0x8210, 0x0519, 0x7294, 0x7294, 
+  0x0519, 0x293c, 0x061e, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0x6d73, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 
+  0x0e0a, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x3084, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x3084, 0x6d73, 0x7294, 0x55a5, 0x7294, 0x3084, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 
+  0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0519, 0xaf83, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x6d73, 0x0519, 
+  0x3084, 0xf58c, 0x8631, 0x0519, 0x8210, 0x6d73, 0xb5bd, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0xf58c, 
+  0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x7294, 0x7294, 0x7294, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x7294, 0x55a5, 0x55a5, 
+  0x7294, 0x7294, 0x7294, 0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0xf58c, 0x34c5, 0xf4dc, 
+  0xf4dc, 0xf4dc, 0x34c5, 0xf58c, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0xf58c, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0xaf83, 
+  0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0x7294, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 
+  0x34c5, 0x7294, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x6d73, 0x55a5, 0xf58c, 0xf58c, 0x8631, 0x8631, 0x7294, 0x34c5, 
+  0xf4dc, 0xf4dc, 0x34c5, 0x8851, 0x0519, 0x0e0a, 0x0e0a, 0x2a00, 0x012b, 0x2a37, 0x2a37, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 
+  0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0xc13f, 0xe13f, 0xc13f, 0xc13f, 0x075e, 0x075e, 0x075e, 0x075e, 0x075e, 
+  0x672c, 0x8210, 0xab52, 0xab52, 0x2b00, 0x022c, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0x2a37, 0xc13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0x2a37, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x672c, 0x0519, 0x0519, 
+  0x0519, 0x0000, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x374c, 0x374c, 0x374c, 0x0519, 0x2d20, 0x010c, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x0519, 0x2e20, 0x010b, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x7c15, 0x2f00, 0x022c, 0xde52, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0xd021, 0x4e12, 0x8400, 0x3f6a, 0x1f72, 0x3f6a, 0xde52, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 
+  0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5b5a, 0x7243, 
+  0x0519, 0x0000, 0x0000, 0x2f3c, 0x011d, 0xb7ea, 0x34c5, 0x8631, 0xaf83, 0x34c5, 0xb5bd, 0xb5bd, 0x55a5, 0x7294, 0x8210, 0x8400, 
+  0x0519, 0x0519, 0x8631, 0x8210, 0x8210, 0x8631, 0x8631, 0x8631, 0x0000, 0x8631, 0x7294, 0x55a5, 0xb5bd, 0xab52, 0x8631, 0xec11, 
+  0xec09, 0x0e0a, 0x303d, 0x010a, 0xf4dc, 0xac8b, 0x6d73, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0xf58c, 0x6d73, 0xab52, 0x3050, 0x0108, 
+  0x6d73, 0xf58c, 0x7294, 0x6d73, 0x8631, 0x0519, 0xec09, 0x0e0a, 0x3125, 0x0108, 0x1f72, 0x3f6a, 0xf741, 0x8400, 0x0000, 0x0000, 
+  0x0000, 0x0000, 0x313f, 0x0105, 0xaf83, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x3152, 0x0105, 0xab52, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 
+  0x3225, 0x010a, 0x5b5a, 0xd021, 0x4e12, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xab52, 0x8210, 0xab52, 0x3238, 0x010b, 0xac8b, 0x6d73, 
+  0xac8b, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x8851, 0x0000, 0x8851, 0xab52, 0x3252, 0x0104, 0x8631, 0xec11, 0x0e0a, 0x0e0a, 0x3301, 
+  0x0154, 0x5b5a, 0x5b5a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x3f6a, 0x5b5a, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x1f72, 
+  0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0xf741, 0x8400, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xaf83, 0xab52, 0x8631, 0x0000, 
+  0x8631, 0x8631, 0x8631, 0x0519, 0x0000, 0x8631, 0x8851, 0xab52, 0x8631, 0x8210, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8210, 
+  0x0000, 0x0519, 0x8631, 0x8631, 0x0519, 0x0000, 0x0000, 0x8400, 0x0000, 0x0000, 0x8631, 0x8631, 0x8631, 0x8210, 0x8210, 0x8400, 
+  0x0519, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0x3400, 0x0253, 0x0e0a, 0x0e0a, 0xd021, 0xf741, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x5b5a, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xde52, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0xf741, 0x8400, 0xab52, 0xb5bd, 
+  0xb5bd, 0x7294, 0x0519, 0x6d73, 0x7ac6, 0x7294, 0x0000, 0x7294, 0x55a5, 0x55a5, 0xaf83, 0x8210, 0x7294, 0x7ee7, 0x7ee7, 0x7ac6, 
+  0xec11, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0xec11, 0x8400, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8210, 0x0519, 0x8631, 0x8400, 
+  0x0519, 0x7294, 0x55a5, 0x55a5, 0xab52, 0x8400, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 
+  0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 
+  0x8210, 0x8631, 0x6d73, 0x6d73, 0xab52, 0x0519, 0xec11, 0x6d73, 0x4e12, 0x0519, 0xab52, 0x6d73, 0x6d73, 0xab52, 0x0000, 0x4e12, 
+  0x7243, 0x7243, 0x7243, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0xab52, 0x6d73, 0x6d73, 0xab52, 0x8210, 
+  0x0519, 0xec09, 0xec11, 0xec11, 0x6d73, 0x6d73, 0x6d73, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x3625, 0x012e, 0xec11, 
+  0x8400, 0x0519, 0x0519, 0x0519, 0x0519, 0xec09, 0x0e0a, 0xec09, 0xec09, 0x0e0a, 0x0519, 0x0519, 0xab52, 0x8851, 0x0519, 0xec11, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 
+  0x0519, 0x0e0a, 0x0e0a, 0x0e0a, 0x0519, 0x8400, 0x8400, 0x0519, 0x0519, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x3726, 0x011c, 0xec09, 
+  0x0e0a, 0x0e0a, 0xec09, 0xec09, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0x7243, 0x7ac6, 0x55a5, 0xec09, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x374b, 0x0103, 0xec09, 0xec09, 0xec09, 
+  0x3831, 0x0104, 0x7243, 0x7ee7, 0x55a5, 0xec09, 0x383f, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x3931, 0x0103, 0x7243, 0x7ac6, 0x55a5, 
+  0x4102, 0x0103, 0x4e12, 0xf58c, 0xf58c, 0x4110, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4202, 0x0114, 0x4e12, 0x7ac6, 0x7ee7, 
+  0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x4302, 0x0215, 0x4e12, 0x7ac6, 0x7ee7, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0xf58c, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4500, 0x0318, 0x4e12, 
+  0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7ac6, 0x7243, 0x4e12, 0x7ac6, 0x7ac6, 0x4e12, 0xaf83, 0x7ac6, 0x7ac6, 
+  0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7ac6, 
+  0x7243, 0x4e12, 0x55a5, 0x55a5, 0x4e12, 0x7243, 0x7ac6, 0x7ac6, 0x7ac6, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4803, 0x0115, 0x4e12, 0x4e12, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4902, 0x0115, 
+  0x4e12, 0x55a5, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4a03, 0x0114, 0x7ac6, 0x7ac6, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4b02, 0x0104, 0xd021, 0x7ac6, 0x7ac6, 
+  0x4e12, 0x4b10, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a
 };
-// 'frame_5_delay-0', 120x76px
-const uint16_t symbolNian6 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 
-  0xe77e, 0xe77e, 0xe77e, 0x124e, 0x83af, 0xe77e, 0xa555, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x8cf5, 0x4c37, 0x8430, 0x124e, 0x124e, 0x8430, 0x4372, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8430, 0xe77e, 0xa555, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x4372, 0x8cf5, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x9472, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xc67a, 0x8cf5, 0x83af, 0xa555, 0xbdb5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xbdb5, 0x8cf5, 0x8cf5, 0xa555, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x8430, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x11ec, 
-  0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x09ec, 0x11ec, 0x11ec, 0x11ec, 
-  0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+// 'frame_5_delay-0', 120x76px, changes from frame 4
+const uint16_t symbolNianDelta6 [] PROGMEM = {
+  0x0047, 0x0001, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x006f, 0x0209, 0xf58c, 0x7ee7, 0x7ee7, 0x7ee7, 0x4e12, 0xaf83, 0x7ee7, 0x55a5, 
+  0x0e0a, 0xd021, 0xf58c, 0x374c, 0x3084, 0x4e12, 0x4e12, 0x3084, 0x7243, 0x0e0a, 0x0100, 0x0104, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0200, 0x0102, 0x4e12, 0x0e0a, 0x0274, 0x0403, 0x4e12, 0x7243, 0x4e12, 0x7243, 0x7ac6, 0xf58c, 0x3084, 0x7ee7, 0x55a5, 0x7243, 
+  0x7ac6, 0xf58c, 0x0d12, 0x0303, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1001, 0x0203, 0x7243, 
+  0xf58c, 0xd021, 0x7294, 0x7ac6, 0x7243, 0x1200, 0x021b, 0x7ac6, 0xf58c, 0xaf83, 0x55a5, 0xb5bd, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0xb5bd, 0xf58c, 0xf58c, 0x55a5, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1400, 0x0104, 0xec09, 
+  0x3084, 0x7ac6, 0x4e12, 0x140d, 0x010d, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x1501, 0x0103, 0x4e12, 0x7243, 0x4e12, 0x1612, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x162e, 0x021e, 0xec09, 0xec11, 
+  0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec09, 0xec11, 0xec11, 0xec11, 
+  0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0x0519, 0x0000, 0x0000, 0x0000, 
   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x3186, 0x8bac, 0x9c4c, 
-  0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 
-  0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x9c4c, 0x8430, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x8906, 0x736d, 0xdcf4, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfe95, 0xfeda, 0xfeda, 0xfeda, 0xfeda, 
-  0xfe95, 0xfeda, 0xfeda, 0xfeda, 0xfeda, 0xfe95, 0xfeda, 0xfe95, 0xfdbb, 0xfeda, 0xfdbb, 0xfeda, 0xfeda, 0xfdbb, 0xfeda, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xc534, 0x736d, 0x5188, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x3186, 0x736d, 0xdcf4, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 
-  0x83af, 0x83af, 0x83af, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x11ec, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0x9472, 0x5188, 0x5188, 0x5188, 0xc534, 0xf49c, 0xfd1f, 0xf49c, 0xeab7, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x11ec, 0x5188, 0x5188, 0x5188, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x5188, 0x52ab, 
-  0x9472, 0x8cf5, 0x9472, 0x3186, 0x736d, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x0000, 0x1082, 
-  0x3186, 0x9472, 0x8cf5, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0xe323, 
-  0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0x83af, 0x83af, 0x9472, 0xf49c, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x736d, 0x0000, 0x736d, 0x83af, 0xa555, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0x9c4c, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 0x736d, 0xdf40, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x9472, 0xf49c, 0xf49c, 0xf49c, 0xf49c, 0xfdbb, 0xfe95, 0x52ab, 0x0084, 0x9472, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x1905, 0x83af, 0x9472, 0x9472, 0x83af, 0x1082, 0x1082, 
-  0x5188, 0xce06, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x52ab, 0x1905, 
-  0x1905, 0x3186, 0x1905, 0x3186, 0x1905, 0x83af, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xce06, 0x1082, 0x5188, 0x52ab, 0xa555, 0x8cf5, 0x83af, 0x52ab, 0x1082, 0x52ab, 0x736d, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8430, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x9472, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x3186, 0x1082, 0x0084, 0x9472, 0x9472, 0xa555, 0x83af, 
-  0x3186, 0x1082, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xc534, 0x5188, 0x52ab, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x3186, 0x11ec, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x67c0, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x67c0, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x372a, 0x2c67, 0x0000, 0x1082, 0x52ab, 0xa555, 0xa555, 0x9472, 0x1905, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0x5188, 0x3186, 0x9472, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5fc2, 0x3fc1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fe1, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5fc2, 0x2c67, 0x2c67, 0x0000, 0x3186, 0x83af, 0x9472, 
-  0xa555, 0x736d, 0x5188, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0x1905, 0x3186, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xc67a, 0xbdb5, 0x8430, 0x9472, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xc67a, 0xbdb5, 0x8430, 0x9472, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x1082, 0x1082, 0x0000, 0x52ab, 0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xe77e, 0xc67a, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 
-  0xc67a, 0x3186, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x372a, 0x5e07, 0x1082, 0x1082, 
-  0x1905, 0x1905, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x52ab, 0x3186, 0x1082, 0x736d, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x8430, 0x8cf5, 0x52ab, 0x3186, 0x1082, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 
-  0x372a, 0x372a, 0x372a, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x26af, 0x2c67, 0x2c67, 0x2c67, 0x1905, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xc534, 0xdcf4, 0xc534, 0x83af, 0x736d, 0x736d, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x9472, 0xa555, 0x736d, 
-  0x736d, 0x736d, 0x9472, 0xdcf4, 0xc534, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x26af, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x09ec, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x8cf5, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfdbb, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x5188, 0x83af, 0xa555, 0xa555, 0x9472, 0x52ab, 0x52ab, 0xa555, 0xa555, 0xa555, 0x52ab, 
-  0x52ab, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x157c, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xf49c, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x736d, 0x52ab, 0x83af, 0x9472, 0xdcf4, 0xdcf4, 0xc534, 0xc534, 0x9472, 0x1905, 0x52ab, 0x8430, 
-  0x8430, 0x83af, 0x1905, 0x3186, 0x83af, 0x8430, 0x8430, 0x3186, 0x3186, 0x9472, 0xc534, 0xdcf4, 0xc534, 0x9c4c, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x157c, 0x1905, 0x736d, 0xdcf4, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xdcf4, 0x3186, 0x52ab, 
-  0x9472, 0xa555, 0xa555, 0xbdb5, 0x9472, 0x1905, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 
-  0x3186, 0x9472, 0xa555, 0xa555, 0x3186, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0xe77e, 0xc67a, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x5a5b, 0x09ec, 0x1905, 0x1082, 0x1082, 0x3186, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x9c4c, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0x9472, 
-  0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0xa555, 0x736d, 0x1905, 0x3186, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x52de, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x6a3f, 0x6a3f, 0xc67a, 0xa1fc, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x5a5b, 0x4372, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x8430, 0x9472, 
-  0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x9472, 0x736d, 
-  0x1082, 0x736d, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x736d, 0x736d, 
-  0x736d, 0x83af, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x41f7, 
-  0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x0000, 0x1082, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 0x0000, 
-  0x0000, 0x1082, 0x1082, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x1082, 0x0000, 0x0000, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x41f7, 0x1082, 0x9472, 0xa555, 0xa555, 0x8430, 0x52ab, 0x1905, 0x0000, 
-  0x1905, 0x1905, 0x0000, 0x3186, 0x83af, 0x83af, 0x83af, 0x1082, 0x0084, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 
-  0x11ec, 0x0084, 0x1082, 0x736d, 0x83af, 0x83af, 0x52ab, 0x0000, 0x1905, 0x1905, 0x0000, 0x3186, 0x83af, 0x83af, 0x83af, 0x1905, 
-  0x0084, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0xa1fc, 0xa1fc, 0x6a3f, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 
-  0xa1fc, 0xa1fc, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x5a5b, 0x5a5b, 0x21d0, 
-  0x1905, 0x83af, 0x9472, 0x9472, 0x736d, 0x1082, 0x1082, 0x0084, 0x09ec, 0x3186, 0x1082, 0x5188, 0x9472, 0x9472, 0x8430, 0x1905, 
-  0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x3186, 0x0084, 0x8430, 0x9472, 0x9472, 0x52ab, 0x0000, 
-  0x11ec, 0x11ec, 0x1905, 0x3186, 0x9472, 0x9472, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x5a5b, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0xe77e, 0x8cf5, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x5a5b, 0x6a3f, 0x6a3f, 0x6a3f, 0x7b98, 0xe77e, 0xc67a, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x41f7, 0x21d0, 0x0a0e, 0x0a0e, 0x21d0, 0x0a0e, 0x0a0e, 0x1905, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x1905, 0x09ec, 
-  0x0a0e, 0x11ec, 0x0084, 0x1082, 0x1082, 0x0000, 0x0084, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x09ec, 0x11ec, 0x0084, 0x0000, 0x0000, 0x0000, 0x0000, 0x09ec, 0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x1082, 0x1082, 0x1905, 
-  0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x4372, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x4372, 0x4372, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x41f7, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 
-  0x11ec, 0x11ec, 0x11ec, 0x3186, 0x11ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x11ec, 0x11ec, 0x3186, 0x11ec, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4c37, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x9472, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0519, 0x1712, 0x0104, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x1800, 0x014e, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x8851, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x8851, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x8631, 
+  0xac8b, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 
+  0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x4c9c, 0x3084, 0x0519, 0xec11, 
+  0x1900, 0x014f, 0x8851, 0x0689, 0x0689, 0x0689, 0x0689, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0x0689, 0x6d73, 
+  0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x95fe, 0xdafe, 0xdafe, 0xdafe, 0xdafe, 0x95fe, 0xdafe, 0xdafe, 0xdafe, 0xdafe, 0x95fe, 
+  0xdafe, 0x95fe, 0xbbfd, 0xdafe, 0xbbfd, 0xdafe, 0xdafe, 0xbbfd, 0xdafe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x34c5, 0x6d73, 0x8851, 
+  0xec11, 0x1a00, 0x0101, 0x23e3, 0x1a2a, 0x0126, 0x23e3, 0x8631, 0x6d73, 0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xab52, 0x8210, 0xec11, 0x1b2b, 0x0125, 0x8210, 0x6d73, 
+  0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x95fe, 
+  0xab52, 0x8210, 0xec11, 0x1c30, 0x011b, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 
+  0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 
+  0x1d00, 0x014c, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0x23e3, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x23e3, 0x0519, 0x6d73, 0x95fe, 
+  0xbbfd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x1e00, 0x0130, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x23e3, 0x8631, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 
+  0x1e3a, 0x011b, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xaf83, 0xaf83, 0xaf83, 0x9cf4, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0xab52, 0x0000, 0xec11, 0xec11, 0x0519, 0x0519, 0x0519, 0xec11, 0x1f2a, 0x010a, 0x23e3, 
+  0x8631, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1f3e, 0x0118, 0xb7ea, 0x7294, 0x8851, 0x8851, 0x8851, 
+  0x34c5, 0x9cf4, 0x1ffd, 0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x6d73, 0x8210, 0xec11, 0xec11, 0x8851, 0x8851, 
+  0x8851, 0x8631, 0xec11, 0x2032, 0x0101, 0x1ffd, 0x203d, 0x011a, 0x9cf4, 0x8851, 0xab52, 0x7294, 0xf58c, 0x7294, 0x8631, 0x6d73, 
+  0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0xab52, 0x0000, 0x8210, 0x8631, 0x7294, 0xf58c, 0x55a5, 0x8631, 
+  0x8210, 0xec11, 0x2100, 0x012c, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x23e3, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0x23e3, 0x81ff, 0x81ff, 0x06ce, 0x8631, 
+  0x2139, 0x011e, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0xaf83, 0x7294, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x95fe, 0x6d73, 0x0000, 0x6d73, 0xaf83, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x8210, 0xec11, 
+  0x2200, 0x012a, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x4c9c, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x0000, 0x6d73, 0x40df, 0x81ff, 0x2238, 0x0119, 0x9cf4, 0xb7ea, 
+  0x9cf4, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x7294, 0x9cf4, 0x9cf4, 0x9cf4, 
+  0x9cf4, 0xbbfd, 0x95fe, 0xab52, 0x8400, 0x7294, 0x55a5, 0x2320, 0x010b, 0x06ce, 0x0519, 0xaf83, 0x7294, 0x7294, 0xaf83, 0x8210, 
+  0x8210, 0x8851, 0x06ce, 0x06ce, 0x2339, 0x011d, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x7294, 0xab52, 0x0519, 0x0519, 0x8631, 0x0519, 0x8631, 0x0519, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x8631, 0x0000, 0x2421, 0x0135, 0x8210, 0x8851, 0xab52, 0x55a5, 0xf58c, 0xaf83, 0xab52, 0x8210, 0xab52, 0x6d73, 0x8210, 
+  0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x9cf4, 0x8631, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 
+  0x6d73, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0x2500, 0x0358, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8631, 0x8210, 0x8400, 
+  0x7294, 0x7294, 0x55a5, 0xaf83, 0x8631, 0x8210, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 
+  0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x34c5, 0x8851, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0xab52, 0x8631, 0xec11, 0xec09, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0xc067, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xc067, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x2a37, 0x672c, 0x0000, 0x8210, 0xab52, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x0000, 0x0000, 
+  0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0xb7ea, 
+  0x8851, 0x8631, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x7294, 0x8631, 0x0519, 0xc067, 0xc067, 0xc067, 0xc067, 
+  0xc067, 0xc25f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xe13f, 0xc25f, 0xc067, 
+  0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc25f, 0x672c, 0x672c, 
+  0x0000, 0x8631, 0xaf83, 0x7294, 0x55a5, 0x6d73, 0x8851, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x0519, 0x8631, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ac6, 
+  0xb5bd, 0x3084, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ac6, 0xb5bd, 0x3084, 0x7294, 0x55a5, 
+  0x55a5, 0x7294, 0x8631, 0x0519, 0x281e, 0x0135, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0x2a37, 0x8210, 0x8210, 0x0000, 0xab52, 
+  0x55a5, 0x55a5, 0x7294, 0x0519, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0x6d73, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0x6d73, 0x291f, 0x0113, 0xe13f, 0xc13f, 0xc13f, 
+  0xe13f, 0xe13f, 0x2a37, 0x075e, 0x8210, 0x8210, 0x0519, 0x0519, 0x0519, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x9cf4, 0x9cf4, 
+  0x293b, 0x0117, 0x1ffd, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0xab52, 0x8631, 0x8210, 0x6d73, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x7294, 0x8631, 0x3084, 0xf58c, 0xab52, 0x8631, 0x8210, 0x2a00, 0x0156, 0xc25f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 
+  0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0xe13f, 0xe13f, 
+  0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 
+  0xaf26, 0x672c, 0x672c, 0x672c, 0x0519, 0x0000, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x8631, 0x8631, 0xf58c, 0x55a5, 0x34c5, 0xf4dc, 0x34c5, 0xaf83, 0x6d73, 
+  0x6d73, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x7294, 0x55a5, 0x6d73, 0x6d73, 0x6d73, 0x7294, 0xf4dc, 0x34c5, 
+  0x34c5, 0x2b00, 0x012a, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xc13f, 0xaf26, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0xec09, 0x2b37, 0x011f, 0xb7ea, 
+  0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x8631, 0x8631, 0xf58c, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x34c5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0xf58c, 0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x2c00, 0x0139, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x374c, 0x0519, 0x6d73, 0x95fe, 0x95fe, 0xbbfd, 
+  0x1ffd, 0x1ffd, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x2c43, 0x010f, 0x34c5, 0x7294, 0x8851, 0xaf83, 0x55a5, 
+  0x55a5, 0x7294, 0xab52, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0xab52, 0xf58c, 0x2d2e, 0x0128, 0x95fe, 0x95fe, 0xbbfd, 0x9cf4, 
+  0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x6d73, 0xab52, 0xaf83, 0x7294, 0xf4dc, 0xf4dc, 
+  0x34c5, 0x34c5, 0x7294, 0x0519, 0xab52, 0x3084, 0x3084, 0xaf83, 0x0519, 0x8631, 0xaf83, 0x3084, 0x3084, 0x8631, 0x8631, 0x7294, 
+  0x34c5, 0xf4dc, 0x34c5, 0x4c9c, 0x2e29, 0x012f, 0x7f2c, 0x7c15, 0x0519, 0x6d73, 0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xf4dc, 0x8631, 0xab52, 0x7294, 0x55a5, 0x55a5, 
+  0xb5bd, 0x7294, 0x0519, 0x8210, 0x8210, 0x8210, 0x8210, 0x0000, 0x0000, 0x8210, 0x8210, 0x8210, 0x8210, 0x8631, 0x7294, 0x55a5, 
+  0x55a5, 0x8631, 0x8210, 0xec11, 0x0e0a, 0x2f00, 0x0158, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7ee7, 0x7ac6, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5b5a, 
+  0xec09, 0x0519, 0x8210, 0x8210, 0x8631, 0x34c5, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x34c5, 0x4c9c, 0x8631, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x7294, 0x7294, 
+  0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x55a5, 0x6d73, 0x0519, 0x8631, 0xec09, 0x0e0a, 0x0e0a, 0x3000, 
+  0x0157, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0x7ac6, 0xfca1, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0xde52, 0x3f6a, 0x1f72, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x5b5a, 0x7243, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0x3084, 
+  0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 0x7294, 
+  0x6d73, 0x8210, 0x6d73, 0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0x6d73, 
+  0x6d73, 0x6d73, 0xaf83, 0xab52, 0x0519, 0xec09, 0x0e0a, 0x0e0a, 0x3077, 0x0201, 0x0e0a, 0x0e0a, 0x3126, 0x012f, 0x1f72, 0xf741, 
+  0x8400, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0x0000, 0x8210, 0x0000, 0x0000, 0x8210, 0x8210, 0x8210, 0x8210, 0x0000, 
+  0x0000, 0x8210, 0x8210, 0x0000, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x8210, 0x0000, 0x0000, 
+  0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0x8210, 0x0000, 0x0000, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x3225, 0x012f, 0x1f72, 
+  0x3f6a, 0xf741, 0x8210, 0x7294, 0x55a5, 0x55a5, 0x3084, 0xab52, 0x0519, 0x0000, 0x0519, 0x0519, 0x0000, 0x8631, 0xaf83, 0xaf83, 
+  0xaf83, 0x8210, 0x8400, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0x8400, 0x8210, 0x6d73, 0xaf83, 0xaf83, 
+  0xab52, 0x0000, 0x0519, 0x0519, 0x0000, 0x8631, 0xaf83, 0xaf83, 0xaf83, 0x0519, 0x8400, 0xec11, 0xec09, 0x0e0a, 0x3301, 0x0152, 
+  0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0xfca1, 0xfca1, 0x3f6a, 0x5b5a, 
+  0x5b5a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0xfca1, 0xfca1, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 
+  0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x5b5a, 0x5b5a, 0xd021, 0x0519, 0xaf83, 0x7294, 0x7294, 0x6d73, 0x8210, 0x8210, 0x8400, 0xec09, 
+  0x8631, 0x8210, 0x8851, 0x7294, 0x7294, 0x3084, 0x0519, 0x0519, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x8631, 0x8400, 0x3084, 0x7294, 0x7294, 0xab52, 0x0000, 0xec11, 0xec11, 0x0519, 0x8631, 0x7294, 0x7294, 0x7294, 0x8631, 0x0519, 
+  0x0e0a, 0x0e0a, 0x3400, 0x0151, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x5b5a, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0xf58c, 0x7ee7, 0xf58c, 0x0e0a, 0x0e0a, 0xd021, 0x5b5a, 0x3f6a, 0x3f6a, 0x3f6a, 0x987b, 0x7ee7, 0x7ac6, 0x5b5a, 0x3f6a, 
+  0x1f72, 0x1f72, 0x1f72, 0x1f72, 0xf741, 0xd021, 0x0e0a, 0x0e0a, 0xd021, 0x0e0a, 0x0e0a, 0x0519, 0x0000, 0x8210, 0x0000, 0x0000, 
+  0x0000, 0x0000, 0x0519, 0xec09, 0x0e0a, 0xec11, 0x8400, 0x8210, 0x8210, 0x0000, 0x8400, 0xec11, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec11, 0x8400, 0x0000, 0x0000, 0x0000, 0x0000, 0xec09, 0x0e0a, 0x0e0a, 0xec11, 
+  0x8210, 0x8210, 0x8210, 0x0519, 0xec11, 0x3500, 0x0150, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x7243, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x7243, 
+  0x7243, 0xd021, 0xd021, 0xd021, 0xd021, 0xf741, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec11, 
+  0xec11, 0xec11, 0x8631, 0xec11, 0xec09, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec11, 0xec11, 0x8631, 0xec11, 0xec09, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0xec11, 0xec11, 0xec11, 0xec11, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec09, 0xec09, 0xec09, 0x3625, 0x0111, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3641, 0x010f, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x3713, 0x0102, 0xd021, 0x4e12, 0x3726, 
+  0x010f, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x374b, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x3812, 0x0203, 0x7243, 0x7ac6, 0xf58c, 0x7243, 0x7ac6, 0xf58c, 0x3831, 0x0104, 0xec09, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x3931, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x4102, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x4202, 0x0204, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4402, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x4477, 0x0101, 0x0e0a, 0x4503, 
+  0x0102, 0x0e0a, 0x0e0a, 0x4600, 0x020b, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4676, 0x0202, 0x374c, 0x7ac6, 0x7243, 
+  0x7294, 0x4803, 0x0107, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4877, 0x0101, 0x0e0a, 0x4902, 0x0304, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a
 };
-// 'frame_6_delay-0', 120x76px
-const uint16_t symbolNian7 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xc67a, 
-  0xc67a, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x21d0, 0x8cf5, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8cf5, 0xa555, 0x124e, 
-  0x124e, 0x8430, 0x4372, 0x0a0e, 0x8cf5, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0x8cf5, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x8430, 0xc67a, 0x8430, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x8cf5, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x4372, 0xc67a, 0x9472, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xa555, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x8430, 0xa555, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0xa555, 0x124e, 0x21d0, 0x4372, 0x4372, 0x0a0e, 0x8cf5, 0xa555, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x9472, 0xe77e, 0xa555, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x8906, 0x8906, 0x8906, 0x5188, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x0084, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x3186, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x9472, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x5188, 0x5188, 0x5188, 0x11ec, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0xe323, 0x8906, 0x3186, 0xc534, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xa555, 0x1905, 0x11ec, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x5188, 0x736d, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfc82, 0xfd41, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 
-  0xfd1f, 0xf49c, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfdbb, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x09ec, 0x11ec, 0x11ec, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xf49c, 0x736d, 0x1905, 0x1082, 0x52ab, 0xf49c, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x1082, 0x0084, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xce06, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x9472, 0x736d, 0x736d, 0x83af, 0x83af, 0x83af, 0x9472, 0xf49c, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x736d, 0x0000, 0x11ec, 0x11ec, 0x1905, 0x3186, 0x736d, 0x736d, 0x736d, 0x3186, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xa555, 
-  0x1082, 0x8430, 0xa555, 0xa555, 0x9472, 0x5188, 0x736d, 0xc534, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x3186, 0x3186, 0x52ab, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x8cf5, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x83af, 0x1082, 
-  0xc534, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x0000, 0x0000, 0x3186, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x7b98, 
-  0x1905, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x736d, 0x83af, 0x83af, 0x83af, 0x8bac, 0x3186, 0x1082, 0x736d, 
-  0x83af, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x0084, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xc534, 0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0x5188, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x0084, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x67c0, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xdf40, 0x67c0, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x67c0, 0xdf40, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x7b98, 
-  0x1082, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0xa555, 0x9472, 0x9472, 0x9472, 0x9472, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x5fc2, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5e07, 
-  0x9c4c, 0x9c4c, 0x9c4c, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xf49c, 0xc534, 0x83af, 0x52ab, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x52ab, 0x52ab, 
-  0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fc1, 0x2c67, 0x1082, 0x1082, 0x1082, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xbdb5, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fe1, 0x3fc1, 0x2c67, 0x3186, 0x1905, 0x52ab, 
-  0x8430, 0x8430, 0x83af, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0xbdb5, 0xe77e, 0xa555, 0x1082, 
-  0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 0xbdb5, 0x1082, 0x8430, 0xa555, 0xa555, 0x9472, 
-  0x1082, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x372a, 0x372a, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x3fc1, 0x3fe1, 
-  0x3fc1, 0x3fc1, 0x5e07, 0x2c67, 0x736d, 0x52ab, 0x52ab, 0x83af, 0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x1082, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x83af, 0x736d, 0xa555, 
-  0xa555, 0x9472, 0x736d, 0x1082, 0x8430, 0xa555, 0xa555, 0x9472, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x372a, 0x372a, 0x2c67, 0x1905, 0x8cf5, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x1905, 0x1905, 
-  0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x1905, 0x9472, 0x9472, 0x3186, 0x1905, 0x1082, 0x8430, 0xa555, 0xa555, 0x9472, 
-  0x1082, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 
-  0x4c37, 0x3186, 0x736d, 0x9472, 0xa555, 0x9472, 0x5188, 0x5188, 0x5188, 0x5188, 0x3186, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 
-  0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x9472, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0xa555, 
-  0xa555, 0x9472, 0x9472, 0x9472, 0xc534, 0xdcf4, 0xdcf4, 0x9472, 0x0084, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x4c37, 0x1082, 0x52ab, 0xa555, 0xa555, 0x9472, 0x1082, 0x1905, 
-  0x11ec, 0x11ec, 0x11ec, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x5188, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xa555, 0x9472, 0x736d, 
-  0x9472, 0xa555, 0xa555, 0x9472, 0x736d, 0x9472, 0xa555, 0xa555, 0x8cf5, 0x736d, 0x83af, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 
-  0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x4c37, 0x1082, 0x736d, 0xa555, 0xa555, 0x9472, 0x1905, 0x21d0, 0x157c, 0x155f, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfdbb, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x52ab, 
-  0xa555, 0xdcf4, 0xdcf4, 0xdcf4, 0xdcf4, 0xa555, 0x8430, 0x1082, 0x8430, 0x8cf5, 0xa555, 0x8430, 0x1082, 0x83af, 0x8cf5, 0x8cf5, 
-  0x9472, 0x1082, 0x5188, 0xbdb5, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x157c, 0x4c37, 0x124e, 0x5188, 0x5188, 0x52ab, 0x4372, 0x4c37, 
-  0x155f, 0x155f, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xdcf4, 0x9472, 0x3186, 0x9472, 0xbdb5, 0xa555, 0xa555, 0xa555, 0x8430, 0x0000, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x0000, 0x1905, 0x3186, 0x1905, 0x1905, 0x0000, 0x5188, 0xa555, 0xa555, 0xa555, 0x5188, 0x3186, 
-  0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x721f, 0x6a3f, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x41f7, 0x21d0, 0x21d0, 0x4372, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 0x4c37, 0x1905, 0x5188, 0x9472, 0xdcf4, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xdcf4, 
-  0x736d, 0x736d, 0x83af, 0x9472, 0xa555, 0xa555, 0x8430, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x736d, 0xa555, 0x83af, 0x736d, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 
-  0x721f, 0x6a3f, 0x5a5b, 0x1905, 0x1082, 0x1905, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xdcf4, 0x52ab, 0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0084, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x41f7, 0x0a0e, 0x736d, 0x83af, 0x83af, 0x736d, 0x736d, 
-  0x8bac, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 
-  0x736d, 0x3186, 0x0000, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x3186, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x6a3f, 0x11ec, 0x1905, 0xa555, 0xa555, 0xa555, 0x52ab, 0x0000, 0x0000, 0x1082, 0x0000, 0x1082, 0x3186, 0x3186, 0x3186, 0x0000, 
-  0x0000, 0x0084, 0x0084, 0x0084, 0x1082, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0000, 0x1082, 0x3186, 0x3186, 0x3186, 
-  0x1082, 0x0000, 0x1082, 0x0084, 0x1082, 0x3186, 0x52ab, 0x3186, 0x3186, 0x1082, 0x0084, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x5a5b, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 
-  0x6a3f, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x5a5b, 
-  0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x5a5b, 0x11ec, 0x1905, 0xa555, 0xa555, 0xa555, 0x52ab, 0x0000, 
-  0x11ec, 0x11ec, 0x0084, 0x5188, 0x9472, 0x8cf5, 0x9472, 0x1905, 0x1905, 0x11ec, 0x09ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x09ec, 0x11ec, 0x0084, 0x3186, 0x9472, 0x8cf5, 0x8cf5, 0x3186, 0x1082, 0x11ec, 0x3186, 0x0084, 0x8430, 0xa555, 0xa555, 
-  0x8430, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x0084, 0x0000, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x3186, 0x3186, 0x3186, 0x1082, 
-  0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x3186, 0x3186, 0x3186, 0x3186, 
-  0x0000, 0x1082, 0x09ec, 0x0a0e, 0x09ec, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x1905, 0x1905, 0x0084, 0x0084, 0x1905, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 
-  0x1905, 0x1905, 0x3186, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 
-  0xa555, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x8cf5, 0xe77e, 0x9472, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 0xa555, 0x124e, 0x21d0, 
-  0x4372, 0x124e, 0x0a0e, 0xa555, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0x4c37, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x8cf5, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8cf5, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0xc67a, 0x8430, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 0x8cf5, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0xa555, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0x8cf5, 0x124e, 0x4372, 0x8cf5, 0x4372, 0x0a0e, 0x8cf5, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 
-  0xe77e, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+// 'frame_6_delay-0', 120x76px, changes from frame 5
+const uint16_t symbolNianDelta7 [] PROGMEM = {
+  0x004b, 0x004f, 0x0203, 0x7ac6, 0x7ac6, 0xd021, 0x7243, 0x7243, 0x4e12, 0x006f, 0x0109, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x016f, 0x0108, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0274, 0x0104, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0374, 0x0303, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0d68, 
+  0x0103, 0xd021, 0xf58c, 0x7243, 0x0e65, 0x0109, 0x4e12, 0x4e12, 0x0e0a, 0x7243, 0x7ac6, 0xf58c, 0x0e0a, 0x4e12, 0x4e12, 0x0f64, 
+  0x010b, 0x4e12, 0xf58c, 0x55a5, 0x4e12, 0x4e12, 0x3084, 0x7243, 0x0e0a, 0xf58c, 0x55a5, 0x4e12, 0x1001, 0x0203, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1065, 0x010a, 0x7243, 0xf58c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xf58c, 0xf58c, 0x4e12, 
+  0x1200, 0x0206, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1263, 0x020d, 
+  0x3084, 0x7ac6, 0x3084, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x55a5, 0xf58c, 0x7243, 0x7ac6, 0x7294, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 0x55a5, 0xf58c, 0x1400, 0x0104, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x1464, 0x010c, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x1501, 0x0103, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x1564, 0x010b, 0x4e12, 0x3084, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xf58c, 0xf58c, 0x4e12, 
+  0x162e, 0x021e, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1665, 0x010a, 
+  0xf58c, 0x55a5, 0x4e12, 0xd021, 0x7243, 0x7243, 0x0e0a, 0xf58c, 0x55a5, 0x4e12, 0x1768, 0x0203, 0x7294, 0x7ee7, 0x55a5, 0xd021, 
+  0x7294, 0x7243, 0x1800, 0x014e, 0x0689, 0x0689, 0x0689, 0x8851, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 
+  0x0519, 0x0519, 0x0519, 0x0519, 0x8400, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0x8631, 
+  0xec09, 0x0e0a, 0x1900, 0x014f, 0xa2e8, 0xa2e8, 0xa2e8, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x23e3, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0x23e3, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x8851, 0x8851, 
+  0x8851, 0xec11, 0xab52, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 
+  0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 0x8851, 
+  0xec11, 0x0e0a, 0x0e0a, 0x1a00, 0x0101, 0xa2e8, 0x1a2b, 0x0225, 0x23e3, 0x0689, 0x8631, 0x34c5, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x55a5, 0x0519, 0xec11, 0xec11, 0x0e0a, 0x8851, 0x6d73, 0x34c5, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x34c5, 0xab52, 
+  0x0519, 0xec09, 0x1c30, 0x011b, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x1d00, 
+  0x014c, 0x82fc, 0x41fd, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0x23e3, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0x8210, 0x6d73, 0x95fe, 0x95fe, 
+  0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x95fe, 0x1e00, 0x0155, 0x41fd, 
+  0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x23e3, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0xbbfd, 0x1ffd, 
+  0x9cf4, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0xbbfd, 0x95fe, 0xab52, 0x0000, 0xec11, 0xec09, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1f31, 0x0103, 0x9cf4, 0xb7ea, 0xb7ea, 0x1f3e, 0x0117, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 
+  0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x6d73, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0xec09, 
+  0xec11, 0xec11, 0x2032, 0x0101, 0x9cf4, 0x203d, 0x0119, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x6d73, 0x0519, 0x8210, 0xab52, 0x9cf4, 
+  0x9cf4, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0xab52, 0x0000, 0xec11, 0x0e0a, 0x0e0a, 0xec11, 0x8210, 0x8210, 0x8400, 
+  0x2100, 0x012c, 0x06ce, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x23e3, 0x0519, 0x2139, 0x011f, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x7294, 0x6d73, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0x7294, 0x9cf4, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x95fe, 0x6d73, 0x0000, 0xec11, 0xec11, 0x0519, 0x8631, 0x6d73, 0x6d73, 0x6d73, 0x8631, 0xec11, 0x2200, 
+  0x012a, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x2238, 0x0120, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x55a5, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8851, 0x6d73, 0x34c5, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x95fe, 0xab52, 0x8210, 0xec11, 0x8631, 0x8631, 0xab52, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x2320, 0x010b, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x2339, 0x011f, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0xf58c, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0x8210, 0x34c5, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 
+  0x6d73, 0x0000, 0x0000, 0x8631, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x2420, 0x0138, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8631, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x987b, 0x0519, 0x3084, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0xac8b, 0x8631, 0x8210, 0x6d73, 0xaf83, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x7294, 0x8631, 0x8400, 0x2500, 0x0158, 0x40df, 0x40df, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 
+  0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x40df, 0x8631, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x34c5, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8851, 
+  0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x8400, 0x2600, 
+  0x0155, 0xc25f, 0xc13f, 0xc067, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x40df, 0xc067, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc067, 
+  0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x8631, 0x6d73, 0x95fe, 0xbbfd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x987b, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x7294, 0x55a5, 0x7294, 0x7294, 0x7294, 0x7294, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x2700, 0x015a, 0xc25f, 0xc25f, 0xc25f, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 
+  0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xe13f, 0xe13f, 0xc13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 
+  0xe13f, 0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0x075e, 
+  0x4c9c, 0x4c9c, 0x4c9c, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x1ffd, 0x9cf4, 0x34c5, 0xaf83, 0xab52, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0xab52, 0xab52, 
+  0x8631, 0xec11, 0x2823, 0x0137, 0xc13f, 0xc13f, 0xe13f, 0xc13f, 0x672c, 0x8210, 0x8210, 0x8210, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0xb7ea, 0x9cf4, 0x9cf4, 0x8631, 
+  0xab52, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xb5bd, 0x55a5, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x8631, 0x2923, 0x010f, 0xc13f, 0x672c, 0x8631, 
+  0x0519, 0xab52, 0x3084, 0x3084, 0xaf83, 0x8210, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0xb7ea, 0xb7ea, 0x293b, 0x011f, 0x9cf4, 0x1ffd, 
+  0x9cf4, 0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xb5bd, 0x7ee7, 0x55a5, 0x8210, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0xb5bd, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8210, 0x8631, 0x2a00, 0x015a, 0x2a37, 
+  0x2a37, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0xc13f, 0xe13f, 0xc13f, 
+  0xc13f, 0x075e, 0x672c, 0x6d73, 0xab52, 0xab52, 0xaf83, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0xb7ea, 
+  0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x8210, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0x6d73, 0x55a5, 0x55a5, 
+  0x7294, 0x6d73, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8210, 0xec11, 0x2b00, 0x012c, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0xc13f, 
+  0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0x2a37, 0x2a37, 0x672c, 0x0519, 0xf58c, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x2b37, 0x0123, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 
+  0x8631, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x0519, 0x0519, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xab52, 
+  0x0519, 0x7294, 0x7294, 0x8631, 0x0519, 0x8210, 0x3084, 0x55a5, 0x55a5, 0x7294, 0x8210, 0x8631, 0x2c00, 0x015a, 0x5f15, 0x5f15, 
+  0x5f15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x374c, 0x8631, 
+  0x6d73, 0x7294, 0x55a5, 0x7294, 0x8851, 0x8851, 0x8851, 0x8851, 0x8631, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xb7ea, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x34c5, 
+  0xf4dc, 0xf4dc, 0x34c5, 0x7294, 0x7294, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x55a5, 0x55a5, 0x7294, 
+  0x7294, 0x7294, 0x34c5, 0xf4dc, 0xf4dc, 0x7294, 0x8400, 0x8631, 0x2d20, 0x023a, 0x374c, 0x8210, 0xab52, 0x55a5, 0x55a5, 0x7294, 
+  0x8210, 0x0519, 0xec11, 0xec11, 0xec11, 0x0000, 0x6d73, 0x95fe, 0xbbfd, 0xbbfd, 0x1ffd, 0x1ffd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x9cf4, 0x8631, 0x8851, 0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x55a5, 
+  0x7294, 0x6d73, 0x7294, 0x55a5, 0x55a5, 0x7294, 0x6d73, 0x7294, 0x55a5, 0x55a5, 0xf58c, 0x6d73, 0xaf83, 0x55a5, 0x34c5, 0xf4dc, 
+  0xf4dc, 0x34c5, 0x0519, 0x8631, 0x374c, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x0519, 0xd021, 0x7c15, 0x5f15, 0x374c, 0x0519, 
+  0x6d73, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0x9cf4, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x9cf4, 0x8631, 0xab52, 0x55a5, 0xf4dc, 0xf4dc, 0xf4dc, 0xf4dc, 0x55a5, 0x3084, 0x8210, 0x3084, 0xf58c, 0x55a5, 0x3084, 
+  0x8210, 0xaf83, 0xf58c, 0xf58c, 0x7294, 0x8210, 0x8851, 0xb5bd, 0xf4dc, 0xf4dc, 0xf4dc, 0x34c5, 0x8210, 0xec11, 0x2f00, 0x0159, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 
+  0x7c15, 0x374c, 0x4e12, 0x8851, 0x8851, 0xab52, 0x7243, 0x374c, 0x5f15, 0x5f15, 0x374c, 0x0519, 0x6d73, 0x95fe, 0x95fe, 0x95fe, 
+  0xbbfd, 0xbbfd, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xf4dc, 0x7294, 
+  0x8631, 0x7294, 0xb5bd, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x0000, 0x0519, 0x0519, 0x0519, 0x0519, 0x0000, 0x0519, 0x8631, 0x0519, 
+  0x0519, 0x0000, 0x8851, 0x55a5, 0x55a5, 0x55a5, 0x8851, 0x8631, 0x8631, 0x3000, 0x0158, 0x3f6a, 0x1f72, 0x3f6a, 0xde52, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 
+  0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x7f2c, 0x7f2c, 0x7f2c, 0xf741, 0xd021, 0xd021, 
+  0x7243, 0xde52, 0x7f2c, 0x7f2c, 0x7f2c, 0x374c, 0x0519, 0x8851, 0x7294, 0xf4dc, 0x95fe, 0x95fe, 0x95fe, 0xbbfd, 0xbbfd, 0xbbfd, 
+  0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xbbfd, 0xf4dc, 0x6d73, 0x6d73, 0xaf83, 0x7294, 0x55a5, 
+  0x55a5, 0x3084, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0x6d73, 0x55a5, 0xaf83, 
+  0x6d73, 0x8631, 0x0519, 0x3121, 0x0136, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x0519, 
+  0x8210, 0x0519, 0x34c5, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 0x95fe, 
+  0x95fe, 0x95fe, 0x95fe, 0x95fe, 0xf4dc, 0xab52, 0x8400, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x8400, 0xec11, 0x3226, 0x0130, 0x1f72, 0x1f72, 0x3f6a, 
+  0xf741, 0x0e0a, 0x6d73, 0xaf83, 0xaf83, 0x6d73, 0x6d73, 0xac8b, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 
+  0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x6d73, 0x8631, 0x0000, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 
+  0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0xab52, 0x8631, 0xec11, 0x3301, 0x0154, 0x3f6a, 
+  0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 
+  0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0xec11, 0x0519, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0x0000, 0x0000, 0x8210, 
+  0x0000, 0x8210, 0x8631, 0x8631, 0x8631, 0x0000, 0x0000, 0x8400, 0x8400, 0x8400, 0x8210, 0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 
+  0x8400, 0x0000, 0x8210, 0x8631, 0x8631, 0x8631, 0x8210, 0x0000, 0x8210, 0x8400, 0x8210, 0x8631, 0xab52, 0x8631, 0x8631, 0x8210, 
+  0x8400, 0x0519, 0xec11, 0x3400, 0x0153, 0x0e0a, 0x0e0a, 0xd021, 0x5b5a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x3f6a, 
+  0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0x5b5a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x5b5a, 0xec11, 0x0519, 
+  0x55a5, 0x55a5, 0x55a5, 0xab52, 0x0000, 0xec11, 0xec11, 0x8400, 0x8851, 0x7294, 0xf58c, 0x7294, 0x0519, 0x0519, 0xec11, 0xec09, 
+  0xec09, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec11, 0x8400, 0x8631, 0x7294, 0xf58c, 0xf58c, 0x8631, 0x8210, 0xec11, 
+  0x8631, 0x8400, 0x3084, 0x55a5, 0x55a5, 0x3084, 0x8210, 0xec11, 0x3500, 0x0139, 0x4e12, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 
+  0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 
+  0xd021, 0xd021, 0xd021, 0x8400, 0x0000, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x8631, 0x8631, 
+  0x8631, 0x8210, 0x0519, 0x3543, 0x0110, 0xec09, 0x8631, 0x8631, 0x8631, 0x8631, 0x0000, 0x8210, 0xec09, 0x0e0a, 0xec09, 0x8631, 
+  0x8631, 0x8631, 0x0519, 0x0000, 0xec11, 0x3629, 0x0110, 0x0519, 0x0519, 0x8400, 0x8400, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0x3644, 0x010f, 0xec09, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0xec09, 
+  0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0x8631, 0x3713, 0x0102, 0x0e0a, 0x0e0a, 0x372b, 0x010d, 0xec09, 0xec09, 
+  0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0x0e0a, 0xec09, 0x3812, 0x0203, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x3831, 0x0101, 0x0e0a, 0x4157, 0x0103, 0x7243, 0x55a5, 0x7243, 0x4255, 0x0108, 0x4e12, 0x0e0a, 0xf58c, 
+  0x7ee7, 0x7294, 0x0e0a, 0x4e12, 0x4e12, 0x4354, 0x010a, 0x55a5, 0x55a5, 0x4e12, 0xd021, 0x7243, 0x4e12, 0x0e0a, 0x55a5, 0xf58c, 
+  0x4e12, 0x4454, 0x0109, 0xf58c, 0x374c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xf58c, 0xf58c, 0x4477, 0x0101, 0x4e12, 0x4552, 
+  0x0102, 0x4e12, 0x4e12, 0x455d, 0x0101, 0x4e12, 0x4652, 0x030d, 0xf58c, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x7243, 0x7ac6, 0xf58c, 0xf58c, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x7243, 
+  0x7ac6, 0x3084, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 0x4676, 
+  0x0202, 0x0e0a, 0x4e12, 0x0e0a, 0x4e12, 0x4877, 0x0101, 0x4e12, 0x4954, 0x0209, 0x55a5, 0xf58c, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x55a5, 0xf58c, 0xf58c, 0xf58c, 0x4e12, 0x7243, 0xf58c, 0x7243, 0x0e0a, 0xf58c, 0xf58c, 0x4b00, 0x0101, 0x4e12, 0x4b57, 
+  0x0103, 0xf58c, 0x7ee7, 0xf58c
 };
-// 'frame_7_delay-0', 120x76px
-const uint16_t symbolNian8 [] PROGMEM = {
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 0xe77e, 0x736d, 0x9472, 0xc67a, 0x8cf5, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 
-  0xc67a, 0xa555, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0xa555, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8430, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xc67a, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x21d0, 0xa555, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x8cf5, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xa555, 0xa555, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x8cf5, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x4372, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0xc67a, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x5188, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x3186, 0x1905, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 
-  0x0084, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x3186, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x8430, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5188, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 
-  0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0x8906, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x52ab, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 0x5188, 
-  0x5188, 0x5188, 0x5188, 0x5188, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe323, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x5188, 0xc534, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xa555, 0x1905, 0x11ec, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe323, 0x5188, 0x736d, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xc534, 0x52ab, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe323, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 
-  0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xe8a2, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfc82, 0xe323, 0x3186, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfdbb, 0xfe95, 0xfe95, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 0xfc82, 
-  0xfc82, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 
-  0xfd1f, 0xf49c, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfdbb, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x1082, 0x11ec, 0x09ec, 0x11ec, 0x11ec, 0x11ec, 0x09ec, 0x09ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xe323, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x9472, 
-  0x3186, 0x1905, 0x3186, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x52ab, 0x0000, 0x11ec, 
-  0x11ec, 0x0084, 0x1082, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x9472, 0x83af, 0x83af, 0x83af, 0x736d, 0x83af, 0x9472, 0xf49c, 0xf49c, 0xf49c, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x736d, 0x0000, 0x1905, 0x3186, 0x736d, 0x736d, 0x736d, 0x3186, 0x1905, 0x09ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xff81, 0xff81, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 0xfd41, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0x52ab, 0x52ab, 0xa555, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfe95, 0x52ab, 0x1082, 0x3186, 
-  0x52ab, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xdf40, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x1905, 0x9472, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfdbb, 0xfe95, 0x736d, 0x0084, 0x9472, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xce06, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0x8bac, 0xce06, 0xff81, 0xff81, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x83af, 0x736d, 0x83af, 0x83af, 0x83af, 0x83af, 0x83af, 0x8bac, 0x736d, 0x83af, 0x8cf5, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0xdf40, 0xdf40, 
-  0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xdf40, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x9c4c, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x0000, 0x736d, 
-  0xce06, 0xce06, 0xce06, 0x3186, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x736d, 0x3186, 
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0xff81, 0xff81, 0xff81, 0xff81, 0xdf40, 0x5fc2, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x67c0, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xff81, 0xce06, 0x3186, 
-  0x52ab, 0xa555, 0xa555, 0x9472, 0x9472, 0x8430, 0x1905, 0x1905, 0x3186, 0x1905, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x736d, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x9472, 0x9472, 0xa555, 0xa555, 0x9472, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5fc2, 0x3fc1, 0x3fe1, 
-  0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5fc2, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 
-  0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x67c0, 0x5e07, 0x1905, 0x1905, 0x52ab, 0x9472, 0xa555, 0xa555, 0x8cf5, 0x83af, 0x83af, 
-  0x83af, 0x1082, 0x0000, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xc534, 0x9472, 0x52ab, 0x8430, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x736d, 0x52ab, 0x3186, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x5e07, 0x1905, 
-  0x0084, 0x1905, 0x83af, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1082, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xeab7, 0x3186, 0x3186, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 
-  0xa555, 0x8cf5, 0xa555, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x372a, 0x52ab, 0x0084, 0x1082, 0x1082, 0x1082, 0x0084, 
-  0x1905, 0x9472, 0x9472, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 0xc67a, 0x3186, 0x736d, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xe77e, 0xc67a, 0x3186, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x5fc2, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 0x372a, 
-  0x372a, 0x372a, 0x372a, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 
-  0x3fc1, 0x372a, 0x5e07, 0x2c67, 0x2c67, 0x2c67, 0x2c67, 0x52ab, 0x1082, 0x52ab, 0x52ab, 0x1082, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x8430, 0x1082, 0x736d, 0xa555, 0xa555, 0xa555, 0xa555, 0x8430, 0x736d, 0x9472, 0xa555, 0x9472, 
-  0x8430, 0x1905, 0x736d, 0xa555, 0xa555, 0x9472, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x5fc2, 0x3fc1, 0x3fc1, 0x3fc1, 0x372a, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x372a, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 
-  0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x26af, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x4c37, 
-  0x1905, 0x1905, 0x1905, 0x0000, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0x3186, 0x1905, 0x1905, 0x83af, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0x736d, 0x1905, 0x8430, 0x8cf5, 0x3186, 0x1082, 0x1905, 0x736d, 0xbdb5, 0xa555, 0x9472, 0x3186, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 0x157c, 
-  0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x157c, 0x157c, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xbdb5, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0x9472, 0x9472, 0x9472, 0x8cf5, 0xa555, 0xa555, 0xa555, 0xa555, 0x8cf5, 0x9472, 0xa555, 0xa555, 0x9472, 
-  0x9472, 0x9472, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfdbb, 0xfdbb, 0xfd1f, 0xfd1f, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xeab7, 
-  0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x8cf5, 0x736d, 0x9472, 0xa555, 
-  0xa555, 0x8cf5, 0x83af, 0x9472, 0xa555, 0xa555, 0xa555, 0x83af, 0x83af, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x5188, 0x1905, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x157c, 0x4c37, 0x1905, 0x736d, 0xfe95, 0xfe95, 0xfe95, 
-  0xfdbb, 0xf49c, 0xeab7, 0xeab7, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0x3186, 0x3186, 0x8cf5, 0xc534, 
-  0xdcf4, 0xdcf4, 0xdcf4, 0xc534, 0x9472, 0x0084, 0x736d, 0x8cf5, 0xa555, 0x9472, 0x1905, 0x736d, 0xa555, 0x8cf5, 0x9472, 0x3186, 
-  0x3186, 0xa555, 0xc534, 0xdcf4, 0xdcf4, 0xc534, 0x3186, 0x1905, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x157c, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 
-  0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x155f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x124e, 0x1905, 0x1082, 0x736d, 0xfe95, 0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xf49c, 0xf49c, 0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 
-  0xfd1f, 0xfd1f, 0xfd1f, 0xfd1f, 0xf49c, 0xc534, 0x3186, 0x83af, 0xc534, 0xbdb5, 0xbdb5, 0xa555, 0x9472, 0x1082, 0x0084, 0x3186, 
-  0x1905, 0x1905, 0x0000, 0x1082, 0x1905, 0x3186, 0x1905, 0x1082, 0x3186, 0xa555, 0xa555, 0xc534, 0x52ab, 0x3186, 0x11ec, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x52de, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 
-  0x6a3f, 0x6a3f, 0x52de, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 0x2c7f, 
-  0x52de, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x6a3f, 0x6a3f, 0x5a5b, 0x41f7, 0x1905, 0x0000, 0x0000, 0x5188, 0x9472, 0xdcf4, 0xfe95, 
-  0xfe95, 0xfe95, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xfdbb, 0xdcf4, 0x83af, 0x736d, 
-  0x83af, 0x9472, 0xa555, 0xa555, 0x8cf5, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x736d, 0x8cf5, 0x9472, 0x83af, 0x3186, 0x1905, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x41f7, 
-  0x1082, 0x1082, 0x0000, 0x0000, 0x0000, 0x1905, 0xc534, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 
-  0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0xfe95, 0x8bac, 0x1082, 0x9472, 0xa555, 0xa555, 0xa555, 0x8cf5, 0xa555, 0xa555, 
-  0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0xa555, 0x52ab, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x5a5b, 0x21d0, 0x124e, 0x83af, 0x83af, 0x83af, 0x83af, 0x52ab, 0x1082, 0x52ab, 0x736d, 
-  0x8bac, 0x736d, 0x736d, 0x736d, 0x8bac, 0x8bac, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x736d, 0x5188, 
-  0x0000, 0x5188, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 0x52ab, 
-  0x52ab, 0x52ab, 0x11ec, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 0x5a5b, 0x5a5b, 
-  0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 
-  0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x5a5b, 0x5a5b, 0x6a3f, 0x41f7, 0x0084, 0x52ab, 
-  0xa555, 0xa555, 0xa555, 0x9472, 0x736d, 0x0084, 0x0000, 0x0000, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x0084, 0x0084, 0x1082, 
-  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x1082, 0x0000, 0x1905, 0x3186, 0x3186, 0x3186, 0x0000, 0x0000, 0x0084, 
-  0x0000, 0x1082, 0x3186, 0x3186, 0x3186, 0x1082, 0x1082, 0x0084, 0x0084, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x5a5b, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x21d0, 0x5a5b, 0x6a3f, 0x6a3f, 0x6a3f, 0x721f, 0x721f, 0x6a3f, 0x721f, 0x721f, 0x721f, 0x721f, 0x6a3f, 0x6a3f, 
-  0x41f7, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x52ab, 0xa555, 0xa555, 0x9472, 0x1905, 0x1905, 0x11ec, 0x0084, 0x1082, 
-  0x9472, 0x8cf5, 0x8cf5, 0x736d, 0x0000, 0x11ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x09ec, 0x11ec, 
-  0x0084, 0x8430, 0x8cf5, 0x8cf5, 0x8430, 0x1082, 0x1905, 0x09ec, 0x0084, 0x1905, 0x9472, 0xa555, 0xa555, 0x52ab, 0x1082, 0x11ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x4372, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 
-  0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x21d0, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1082, 0x1082, 
-  0x3186, 0x3186, 0x3186, 0x3186, 0x11ec, 0x0a0e, 0x11ec, 0x3186, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x11ec, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x3186, 0x3186, 0x3186, 0x1905, 0x0000, 0x11ec, 0x0a0e, 
-  0x11ec, 0x3186, 0x3186, 0x3186, 0x3186, 0x1082, 0x1082, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x11ec, 0x0a0e, 0x0a0e, 0x11ec, 0x1905, 0x1905, 0x1905, 0x1905, 0x1905, 0x09ec, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x09ec, 0x0a0e, 0x09ec, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x8cf5, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 
-  0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x8cf5, 0x8cf5, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x09ec, 0x0a0e, 0x124e, 0xc67a, 0xc67a, 0xe77e, 0x8cf5, 0x09ec, 0xc67a, 0xc67a, 0x52ab, 0x736d, 0xc67a, 0xc67a, 0xc67a, 0x736d, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x09ec, 0x0a0e, 0x124e, 0xa555, 0xc67a, 0xc67a, 0x4372, 0x0a0e, 
-  0xa555, 0xa555, 0x124e, 0x736d, 0xc67a, 0xc67a, 0xc67a, 0x4372, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x124e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0xa555, 0xa555, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 
-  0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e, 0x124e, 0x0a0e, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0xc67a, 0xc67a, 0x124e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 
-  0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x0a0e, 0x124e
+// 'frame_7_delay-0', 120x76px, changes from frame 6
+const uint16_t symbolNianDelta8 [] PROGMEM = {
+  0x0046, 0x0045, 0x010d, 0x4e12, 0x55a5, 0x7ee7, 0x6d73, 0x7294, 0x7ac6, 0xf58c, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0146, 0x010c, 0x4e12, 0x4e12, 0x7ac6, 0x55a5, 0x7243, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0247, 0x0104, 
+  0xec09, 0x55a5, 0xf58c, 0x4e12, 0x0d5b, 0x0103, 0x7243, 0x3084, 0x4e12, 0x0d68, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e5b, 0x0113, 
+  0x7ac6, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0f5b, 0x0114, 0x7243, 0x7243, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1065, 0x010a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1255, 0x021b, 0xd021, 0x55a5, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0xf58c, 0x7ac6, 0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x4e12, 0x55a5, 0x55a5, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xf58c, 0x55a5, 0x4e12, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1456, 0x011a, 0x4e12, 
+  0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1564, 0x010b, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x165b, 0x0114, 0x7243, 0x7243, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x175b, 0x0203, 0x7ac6, 0x7ac6, 
+  0x7243, 0x7243, 0x3084, 0x4e12, 0x1768, 0x0203, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x1800, 0x012f, 0x4e12, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0xec11, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0x8851, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x8851, 0x0689, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x8631, 0x1900, 0x012e, 0x8851, 
+  0x0689, 0x0689, 0x0689, 0x0689, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 0x0689, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x23e3, 0x1a00, 0x0101, 0x23e3, 
+  0x1a2a, 0x0104, 0xa2e8, 0xa2e8, 0x23e3, 0x8851, 0x1d00, 0x022c, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 
+  0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0xa2e8, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x23e3, 0x8631, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 
+  0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x82fc, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x23e3, 0x0519, 
+  0x1e41, 0x0101, 0x9cf4, 0x1f2b, 0x0201, 0x0519, 0x0519, 0x1f3f, 0x0106, 0x9cf4, 0xb7ea, 0xb7ea, 0xb7ea, 0x1ffd, 0x1ffd, 0x1f50, 
+  0x0106, 0xec09, 0xec11, 0xec11, 0xec11, 0xec09, 0xec09, 0x203f, 0x0107, 0x7294, 0x8631, 0x0519, 0x8631, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x2050, 0x0107, 0xec11, 0x8400, 0x8210, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x2100, 0x012c, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8631, 0x213d, 0x061b, 0x9cf4, 0x7294, 0xaf83, 0xaf83, 0xaf83, 0x6d73, 0xaf83, 
+  0x7294, 0x9cf4, 0x9cf4, 0x9cf4, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0x95fe, 0x6d73, 0x0000, 0x0519, 0x8631, 0x6d73, 0x6d73, 0x6d73, 
+  0x8631, 0x0519, 0xec09, 0x0e0a, 0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0xab52, 0xab52, 0x55a5, 0x9cf4, 0x1ffd, 0x1ffd, 
+  0x1ffd, 0x1ffd, 0x1ffd, 0x95fe, 0xab52, 0x8210, 0x8631, 0xab52, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x9cf4, 
+  0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x7294, 0x1ffd, 0x1ffd, 0x1ffd, 0x1ffd, 0xbbfd, 0x95fe, 0x6d73, 
+  0x8400, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0xf58c, 0xaf83, 0x6d73, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xac8b, 0x6d73, 0xaf83, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x6d73, 0x8631, 
+  0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x3084, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 
+  0x9cf4, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x7294, 0x55a5, 0x55a5, 0x7294, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0000, 0xec11, 0x0e0a, 0x2200, 0x012a, 0x41fd, 0x41fd, 0x41fd, 
+  0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x41fd, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x2420, 0x0108, 0x06ce, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 0xac8b, 
+  0x06ce, 0x2500, 0x012b, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 
+  0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x40df, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 
+  0x81ff, 0x81ff, 0x40df, 0x4c9c, 0x8631, 0x8631, 0x8631, 0x8631, 0x8631, 0x0000, 0x6d73, 0x06ce, 0x06ce, 0x06ce, 0x2600, 0x022c, 
+  0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x40df, 0xc25f, 0xe13f, 0xc13f, 0xe13f, 0xc13f, 0xe13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xc067, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x81ff, 0x06ce, 0x8631, 
+  0xab52, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x3084, 0x0519, 0x0519, 0x8631, 0x0519, 0x0519, 0x0000, 0xc067, 0xc067, 0xc067, 0xc067, 
+  0xc067, 0xc25f, 0xc13f, 0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0xe13f, 0xc13f, 0xe13f, 0xe13f, 0xe13f, 0xc25f, 0xc067, 
+  0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0xc067, 0x075e, 0x0519, 0x0519, 0xab52, 0x7294, 0x55a5, 
+  0x55a5, 0xf58c, 0xaf83, 0xaf83, 0xaf83, 0x8210, 0x0000, 0x0000, 0x273c, 0x0106, 0x34c5, 0x7294, 0xab52, 0x3084, 0x55a5, 0x55a5, 
+  0x2754, 0x0106, 0x6d73, 0xab52, 0x8631, 0xec11, 0x0e0a, 0x0e0a, 0x281e, 0x010c, 0x075e, 0x0519, 0x8400, 0x0519, 0xaf83, 0xf58c, 
+  0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x283c, 0x010c, 0x8631, 0x8631, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0xf58c, 0x55a5, 0x55a5, 0x2851, 0x0109, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x291f, 
+  0x010d, 0xc13f, 0x2a37, 0x2a37, 0xab52, 0x8400, 0x8210, 0x8210, 0x8210, 0x8400, 0x0519, 0x7294, 0x7294, 0x0519, 0x293c, 0x061e, 
+  0x8631, 0x8631, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x7ee7, 0x7ac6, 0x8631, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 
+  0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x7294, 0x3084, 0x8210, 0x6d73, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x3084, 0x6d73, 0x7294, 
+  0x55a5, 0x7294, 0x3084, 0x0519, 0x6d73, 0x55a5, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0xf58c, 0x55a5, 
+  0x55a5, 0x55a5, 0x55a5, 0x8631, 0x0519, 0x0519, 0xaf83, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0x6d73, 0x0519, 0x3084, 0xf58c, 0x8631, 
+  0x8210, 0x0519, 0x6d73, 0xb5bd, 0x55a5, 0x7294, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0xf58c, 0xb5bd, 0xf4dc, 0xf4dc, 
+  0xf4dc, 0x7294, 0x7294, 0x7294, 0xf58c, 0x55a5, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x7294, 0x55a5, 0x55a5, 0x7294, 0x7294, 0x7294, 
+  0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0xf58c, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x34c5, 
+  0xf58c, 0x6d73, 0x7294, 0x55a5, 0x55a5, 0xf58c, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0xaf83, 0xaf83, 0x55a5, 0x34c5, 0xf4dc, 
+  0xf4dc, 0x34c5, 0x8851, 0x0519, 0x0e0a, 0x0e0a, 0x8631, 0x8631, 0xf58c, 0x34c5, 0xf4dc, 0xf4dc, 0xf4dc, 0x34c5, 0x7294, 0x8400, 
+  0x6d73, 0xf58c, 0x55a5, 0x7294, 0x0519, 0x6d73, 0x55a5, 0xf58c, 0x7294, 0x8631, 0x8631, 0x55a5, 0x34c5, 0xf4dc, 0xf4dc, 0x34c5, 
+  0x8631, 0x0519, 0x0e0a, 0x0e0a, 0x2a00, 0x032c, 0xc25f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 
+  0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0x2a37, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 
+  0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xe13f, 0xc13f, 0x2a37, 0x075e, 0x672c, 0x672c, 0x672c, 0x672c, 0xab52, 0x8210, 0xab52, 
+  0xab52, 0x8210, 0xc25f, 0xc13f, 0xc13f, 0xc13f, 0x2a37, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x2a37, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 0xc13f, 
+  0xc13f, 0xc13f, 0xaf26, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x374c, 0x0519, 0x0519, 0x0519, 0x0000, 0x7c15, 0x7c15, 
+  0x7c15, 0x7c15, 0x7c15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x7c15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x7c15, 0x7c15, 0x374c, 0x0519, 0x2d00, 0x0201, 0x7c15, 0x5f15, 0x2d20, 0x010c, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x374c, 0x0519, 0x2e20, 0x010a, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7c15, 0x2f00, 0x022c, 0x7c15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x5f15, 0x5f15, 0x5f15, 
+  0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x5f15, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0xde52, 0x4e12, 0x0519, 0x8210, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x3f6a, 
+  0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0x3f6a, 0x3f6a, 0xde52, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 
+  0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0x7f2c, 0xde52, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x3f6a, 0x3f6a, 0x5b5a, 0xf741, 0x0519, 
+  0x0000, 0x0000, 0x2f3c, 0x011d, 0x9cf4, 0x34c5, 0x8631, 0xaf83, 0x34c5, 0xb5bd, 0xb5bd, 0x55a5, 0x7294, 0x8210, 0x8400, 0x8631, 
+  0x0519, 0x0519, 0x0000, 0x8210, 0x0519, 0x8631, 0x0519, 0x8210, 0x8631, 0x55a5, 0x55a5, 0x34c5, 0xab52, 0x8631, 0xec11, 0xec09, 
+  0x0e0a, 0x303d, 0x010a, 0xf4dc, 0xaf83, 0x6d73, 0xaf83, 0x7294, 0x55a5, 0x55a5, 0xf58c, 0xab52, 0xab52, 0x3050, 0x0108, 0x6d73, 
+  0xf58c, 0x7294, 0xaf83, 0x8631, 0x0519, 0xec09, 0x0e0a, 0x3121, 0x010c, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0xf741, 
+  0x8210, 0x8210, 0x0000, 0x0000, 0x0000, 0x313f, 0x0107, 0xac8b, 0x8210, 0x7294, 0x55a5, 0x55a5, 0x55a5, 0xf58c, 0x3152, 0x0105, 
+  0xab52, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x3225, 0x0111, 0x5b5a, 0xd021, 0x4e12, 0xaf83, 0xaf83, 0xaf83, 0xaf83, 0xab52, 0x8210, 
+  0xab52, 0x6d73, 0xac8b, 0x6d73, 0x6d73, 0x6d73, 0xac8b, 0xac8b, 0x323f, 0x0104, 0x8851, 0x0000, 0x8851, 0xab52, 0x3252, 0x0104, 
+  0xec11, 0xec11, 0x0e0a, 0x0e0a, 0x3300, 0x0155, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 
+  0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 
+  0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x5b5a, 0x5b5a, 0x5b5a, 0x3f6a, 0xf741, 0x8400, 0xab52, 0x55a5, 0x55a5, 
+  0x55a5, 0x7294, 0x6d73, 0x8400, 0x0000, 0x0000, 0x8631, 0x8631, 0x8631, 0x0519, 0x0000, 0x8400, 0x8400, 0x8210, 0x8400, 0x8400, 
+  0x8400, 0x8400, 0x8400, 0x8400, 0x8400, 0x8210, 0x0000, 0x0519, 0x8631, 0x8631, 0x8631, 0x0000, 0x0000, 0x8400, 0x0000, 0x8210, 
+  0x8631, 0x8631, 0x8631, 0x8210, 0x8210, 0x8400, 0x8400, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0x3400, 0x0253, 0x3f6a, 0x1f72, 0x1f72, 
+  0x3f6a, 0x5b5a, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 
+  0x5b5a, 0x3f6a, 0x3f6a, 0x3f6a, 0x1f72, 0x1f72, 0x3f6a, 0x1f72, 0x1f72, 0x1f72, 0x1f72, 0x3f6a, 0x3f6a, 0xf741, 0xd021, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0xec11, 0x8210, 0xab52, 0x55a5, 0x55a5, 0x7294, 0x0519, 0x0519, 0xec11, 0x8400, 0x8210, 0x7294, 0xf58c, 0xf58c, 
+  0x6d73, 0x0000, 0xec11, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0xec09, 0xec11, 0x8400, 0x3084, 0xf58c, 
+  0xf58c, 0x3084, 0x8210, 0x0519, 0xec09, 0x8400, 0x0519, 0x7294, 0x55a5, 0x55a5, 0xab52, 0x8210, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x7243, 0xd021, 0xd021, 0xd021, 0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 0xd021, 
+  0xd021, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec11, 0x8210, 0x8210, 0x8631, 0x8631, 0x8631, 0x8631, 0xec11, 0x0e0a, 0xec11, 0x8631, 
+  0x8631, 0x8631, 0x8631, 0x0519, 0x0000, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0xec11, 0x8631, 0x8631, 0x8631, 0x0519, 0x0000, 0xec11, 0x0e0a, 0xec11, 0x8631, 0x8631, 0x8631, 0x8631, 0x8210, 0x8210, 0xec11, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x3625, 0x012e, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0xec09, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0xec11, 0x0e0a, 0x0e0a, 0xec11, 0x0519, 0x0519, 0x0519, 0x0519, 0x0519, 0xec09, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x372b, 0x010d, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0xec09, 0xec09, 0x0e0a, 0xec09, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x3b00, 0x0101, 0x0e0a, 0x4148, 0x0103, 0xf58c, 0xf58c, 0x4e12, 0x4157, 0x0103, 0x0e0a, 0x0e0a, 0x0e0a, 0x4247, 
+  0x0304, 0xec09, 0x7ac6, 0x7ac6, 0x4e12, 0xec09, 0x7ac6, 0x7ac6, 0x4e12, 0xec09, 0xf58c, 0xf58c, 0x4e12, 0x4255, 0x0108, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4354, 0x010a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x4454, 0x0109, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4543, 0x0111, 
+  0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x455d, 0x0101, 0x0e0a, 0x4642, 0x021d, 0x4e12, 0x7ac6, 0x7ac6, 0x7ee7, 0xf58c, 0xec09, 0x7ac6, 0x7ac6, 0xab52, 0x6d73, 
+  0x7ac6, 0x7ac6, 0x7ac6, 0x6d73, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x4e12, 0x55a5, 0x7ac6, 0x7ac6, 0x7243, 0x0e0a, 0x55a5, 0x55a5, 0x4e12, 0x6d73, 0x7ac6, 0x7ac6, 0x7ac6, 
+  0x7243, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x4843, 0x011c, 0x4e12, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 0x4e12, 0x4e12, 0x4e12, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4948, 0x0303, 
+  0x55a5, 0x55a5, 0x4e12, 0x7ac6, 0x7ac6, 0x4e12, 0x7ac6, 0x7ac6, 0x4e12, 0x4954, 0x0209, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 
+  0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x0e0a, 0x4b57, 0x0103, 0x0e0a, 
+  0x0e0a, 0x0e0a
 };
@@ -160,6 +160,7 @@ void set_accl_interrupt() {
 }
 
 void interrupt_charged() {
+  invalidate_screen();
   sleep_up(WAKEUP_CHARGED);
   set_sleep_time();
   if (get_charged())
@@ -169,6 +170,7 @@ void interrupt_charged() {
 }
 
 void interrupt_charge() {
+  invalidate_screen();
   sleep_up(WAKEUP_CHARGE);
   set_sleep_time();
   if (get_charge())
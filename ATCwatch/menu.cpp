@@ -8,6 +8,7 @@
 #include "backlight.h"
 #include "bootloader.h"
 #include "display.h"
+#include "fast_spi.h"
 #include "menuAppsBase.h"
 #include "menu_Boot.h"
 #include "menu_Home.h"
@@ -17,6 +18,7 @@
 #include "menu_Update.h"
 #include "menu_Off.h"
 #include "menu_Notify.h"
+#include "menu_AlwaysOn.h"
 #include "menu_Battery.h"
 #include "menu_Settings.h"
 #include "menu_Error.h"
@@ -25,8 +27,10 @@
 #include "menu_Accl.h"
 
 long last_main_run;
+bool screen_invalid = true;
 int vars_menu = -1;
 int vars_max_menu = 3;
+int vars_menu_scroll = 0;//1 if the next menu comes in from below, -1 from above
 
 
 BootScreen bootScreen;
@@ -37,6 +41,7 @@ RebootScreen rebootScreen;
 UpdateScreen updateScreen;
 OffScreen offScreen;
 NotifyScreen notifyScreen;
+AlwaysOnScreen alwaysOnScreen;
 BatteryScreen batteryScreen;
 SettingsScreen settingsScreen;
 ErrorScreen errorScreen;
@@ -78,6 +83,11 @@ void display_home() {
   vars_menu = 0;
 }
 
+void display_always_on() {
+  lastScreen = currentScreen;
+  currentScreen = &alwaysOnScreen;
+}
+
 void display_error() {
   lastScreen = &errorScreen;
   currentScreen = &errorScreen;
@@ -88,6 +98,7 @@ void display_notify() {
   lastScreen = currentScreen;
   currentScreen = &notifyScreen;
   vars_menu = 0;
+  invalidate_screen();
 }
 
 void display_booting() {
@@ -99,17 +110,34 @@ void display_booting() {
 }
 
 void display_screen(bool ignoreWait) {
-  if (millis() - last_main_run > get_menu_delay_time()|| ignoreWait) {
+  uint32_t refresh_time = get_menu_delay_time();
+  bool refresh_due = refresh_time != NO_REFRESH_TIME && millis() - last_main_run > refresh_time;
+  if (screen_invalid || refresh_due || currentScreen != oldScreen || ignoreWait) {
+    int scroll = currentScreen != oldScreen ? vars_menu_scroll : 0;
+    vars_menu_scroll = 0;
     last_main_run = millis();
+    screen_invalid = false;
+    reset_spi_stats();
+    begin_display_frame();
     if (currentScreen != oldScreen) {
       oldScreen->post();
       oldScreen = currentScreen;
+      set_display_color_bits(currentScreen->colorBits());
       currentScreen->pre();
     }
     currentScreen->main();
+    if (scroll)
+      scroll_display_frame(scroll > 0);
+    else
+      end_display_frame();
+    end_spi_frame();
   }
 }
 
+void invalidate_screen() {
+  screen_invalid = true;
+}
+
 void check_menu() {
   touch_data_struct touch_data = get_touch();
   if (touch_data.gesture == TOUCH_SLIDE_UP) {
@@ -125,6 +153,7 @@ void check_menu() {
   } else if (touch_data.gesture == TOUCH_SLIDE_RIGHT) {
     currentScreen->right();
   }
+  invalidate_screen();
 }
 
 uint32_t get_menu_delay_time() {
@@ -147,13 +176,15 @@ void set_last_menu() {
 void inc_vars_menu() {
   lastScreen = currentScreen;
   vars_menu++;
-  if (vars_menu > vars_max_menu | vars_menu < 0)vars_menu = 0;
+  if (vars_menu > vars_max_menu || vars_menu < 0)vars_menu = 0;
   currentScreen = menus[vars_menu];
+  vars_menu_scroll = 1;
 }
 
 void dec_vars_menu() {
   lastScreen = currentScreen;
   vars_menu--;
-  if (vars_menu < 0 | vars_menu > vars_max_menu)vars_menu = vars_max_menu;
+  if (vars_menu < 0 || vars_menu > vars_max_menu)vars_menu = vars_max_menu;
   currentScreen = menus[vars_menu];
+  vars_menu_scroll = -1;
 }
@@ -7,10 +7,12 @@
 
 void init_menu();
 void display_home();
+void display_always_on();
 void display_error();
 void display_notify();
 void display_booting();
 void display_screen(bool ignoreWait=false);
+void invalidate_screen();
 void check_menu();
 uint32_t get_menu_delay_time();
 int get_sleep_time_menu();
@@ -16,7 +16,7 @@ void rectangle(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color) {
 }
 
 void displayIconAndText(uint32_t x, uint32_t y, uint32_t w, uint32_t h, String text, const uint16_t *buff) {
-  displayImage(x, y, w, (h - 1), buff);
+  displayImageRLE(x, y, w, (h - 1), buff);
   displayRect(x + 1, y + h + 2, w, 8, 0x0000);
   displayPrintln(x + 1, y + h + 2, text);
 }
@@ -24,17 +24,17 @@ void displayIconAndText(uint32_t x, uint32_t y, uint32_t w, uint32_t h, String t
 void menuAppsBase(uint32_t page) {
   displayRect(0, 0, 240, 240, 0x0000);
   if (page == 1)
-    displayImage(228, 100, 12, 12, symbolCheck2);
+    displayImageIndexed(228, 100, 12, 12, symbolCheck2);
   else
-    displayImage(228, 100, 12, 12, symbolCheck1);
+    displayImageIndexed(228, 100, 12, 12, symbolCheck1);
   if (page == 2)
-    displayImage(228, 114, 12, 12, symbolCheck2);
+    displayImageIndexed(228, 114, 12, 12, symbolCheck2);
   else
-    displayImage(228, 114, 12, 12, symbolCheck1);
+    displayImageIndexed(228, 114, 12, 12, symbolCheck1);
   if (page == 3)
-    displayImage(228, 128, 12, 12, symbolCheck2);
+    displayImageIndexed(228, 128, 12, 12, symbolCheck2);
   else
-    displayImage(228, 128, 12, 12, symbolCheck1);
+    displayImageIndexed(228, 128, 12, 12, symbolCheck1);
 
   /* rectangle(25, 19, 82, 82, borderColor);
     rectangle(25, 128, 82, 82, borderColor);
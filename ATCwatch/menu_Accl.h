@@ -2,6 +2,7 @@
 #pragma once
 #include "Arduino.h"
 #include "class.h"
+#include "classWidget.h"
 #include "images.h"
 #include "menu.h"
 #include "display.h"
@@ -14,40 +15,30 @@
 #include "heartrate.h"
 
 
-class AcclScreen : public TheScreen
+class AcclScreen : public WidgetScreen
 {
   public:
     AcclScreen() {
+      add(&title);
+      for (int i = 0; i < 9; i++) {
+        add(&labels[i]);
+        add(&values[i]);
+      }
     }
 
-    virtual void pre()
-    {
-      displayRect(0, 0, 240, 240, 0x0000);
-      displayPrintln(0, 0, "Accl:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 16, "X:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 32, "Y:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 48, "Z:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 64, "Temp:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 64 + 16, "Steps:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 16 + 16 + 16 + 16 + 16 + 16, "Rslt:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 16 + 16 + 16 + 16 + 16 + 16 + 16,    "Enabled:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16, "Interrupt:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16+16, "Activity:", 0xFFFF, 0x0000, 2);
-    }
-
-    virtual void main()
+    virtual void update()
     {
       accl_data_struct accl_data = get_accl_data();
 
-      displayPrintln((2 * 5 * 3), 16, (String)accl_data.x + "    ", 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 3), 16 + 16, (String)accl_data.y + "    ", 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 3), 16 + 16 + 16, (String)accl_data.z + "    ", 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 6), 16 + 16 + 16 + 16, (String)accl_data.temp + "    ", 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 7), 16 + 16 + 16 + 16 + 16, (String)accl_data.steps + "    ", 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 6), 16 + 16 + 16 + 16 + 16 + 16, (String)accl_data.result, 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 9), 16 + 16 + 16 + 16 + 16 + 16 + 16, (String)accl_data.enabled, 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 11), 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16, (String)accl_data.interrupt, 0xFFFF, 0x0000, 2);
-      displayPrintln((2 * 5 * 10), 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16+16, (String)accl_data.activity, 0xFFFF, 0x0000, 2);
+      values[0].set((String)accl_data.x);
+      values[1].set((String)accl_data.y);
+      values[2].set((String)accl_data.z);
+      values[3].set((String)accl_data.temp);
+      values[4].set((String)accl_data.steps);
+      values[5].set((String)accl_data.result);
+      values[6].set((String)accl_data.enabled);
+      values[7].set((String)accl_data.interrupt);
+      values[8].set((String)accl_data.activity);
     }
 
     virtual void up()
@@ -61,5 +52,15 @@ class AcclScreen : public TheScreen
     }
 
   private:
+    LabelWidget title = LabelWidget(0, 0, "Accl:");
+    LabelWidget labels[9] = {LabelWidget(0, 16, "X:"), LabelWidget(0, 32, "Y:"), LabelWidget(0, 48, "Z:"), LabelWidget(0, 64, "Temp:"), LabelWidget(0, 64 + 16, "Steps:"),
+                             LabelWidget(0, 16 + 16 + 16 + 16 + 16 + 16, "Rslt:"), LabelWidget(0, 16 + 16 + 16 + 16 + 16 + 16 + 16, "Enabled:"),
+                             LabelWidget(0, 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16, "Interrupt:"), LabelWidget(0, 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16, "Activity:")
+                            };
+    ValueWidget values[9] = {ValueWidget((2 * 5 * 3), 16), ValueWidget((2 * 5 * 3), 16 + 16), ValueWidget((2 * 5 * 3), 16 + 16 + 16),
+                             ValueWidget((2 * 5 * 6), 16 + 16 + 16 + 16), ValueWidget((2 * 5 * 7), 16 + 16 + 16 + 16 + 16),
+                             ValueWidget((2 * 5 * 6), 16 + 16 + 16 + 16 + 16 + 16), ValueWidget((2 * 5 * 9), 16 + 16 + 16 + 16 + 16 + 16 + 16),
+                             ValueWidget((2 * 5 * 11), 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16), ValueWidget((2 * 5 * 10), 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16 + 16)
+                            };
 
 };
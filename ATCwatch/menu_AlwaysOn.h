@@ -0,0 +1,62 @@
+
+#pragma once
+#include "Arduino.h"
+#include "classScreen.h"
+#include "menu.h"
+#include "display.h"
+#include "backlight.h"
+#include "sleep.h"
+#include "time.h"
+
+#define ALWAYS_ON_TOP 100
+#define ALWAYS_ON_ROWS 40
+
+//shown while sleeping if always on is enabled, the panel only drives the rows of the clock in 8 colours.
+//By default the backlight is dimmed, the IPS panel shows next to nothing without it. Turning "AOD light" off
+//in the settings saves the backlight current, but the panel keeps drawing its own and the clock is hard to read
+class AlwaysOnScreen : public TheScreen
+{
+  public:
+    AlwaysOnScreen() {
+    }
+
+    virtual void pre()
+    {
+      set_display_scroll_area(0, DISPLAY_GRAM_ROWS);//the partial area is given in memory rows
+      display_idle(true, ALWAYS_ON_TOP, ALWAYS_ON_ROWS);
+      displayRect(0, ALWAYS_ON_TOP, 240, ALWAYS_ON_ROWS, 0x0000);
+      reset_text_cache(&time_cache);
+      if (get_always_on_light())dim_backlight();
+    }
+
+    virtual void main()
+    {
+      time_data_struct time_data = get_time();
+      char time_string[6];
+      sprintf(time_string, "%02i:%02i", time_data.hr, time_data.min);
+      //only sends something when the minute changed
+      displayPrintlnCached(45, ALWAYS_ON_TOP, time_string, &time_cache, is_night() ? 0xF800 : 0xFFFF, 0x0000, 5);
+    }
+
+    virtual void post()
+    {
+      display_idle(false);
+    }
+
+    virtual uint32_t refreshTime()
+    {
+      return 1000;
+    }
+
+    virtual uint32_t colorBits()
+    {
+      return 12;
+    }
+
+    virtual void right()
+    {
+    }
+
+  private:
+    text_cache_struct time_cache;
+};
@@ -2,6 +2,7 @@
 #pragma once
 #include "Arduino.h"
 #include "class.h"
+#include "classWidget.h"
 #include "images.h"
 #include "menu.h"
 #include "display.h"
@@ -14,37 +15,37 @@
 #include "heartrate.h"
 
 
-class BatteryScreen : public TheScreen
+class BatteryScreen : public WidgetScreen
 {
   public:
     BatteryScreen() {
+      add(&title);
+      add(&charge_icon);
+      add(&charge_value);
+      add(&percent_value);
+      add(&percent_bar);
     }
 
-    virtual void pre()
-    {
-      charge_symbol_change = false;
-      displayRect(0, 0, 240, 240, 0x0000);
-      displayPrintln(0, 0, "Battery:", 0xFFFF, 0x0000, 2);
-    }
-
-    virtual void main()
+    virtual void update()
     {
+      if (charge_icon.set(get_charge() ? symbolBattery2 : symbolBattery1))
+        charge_value.invalidate();//the icon was drawn over the percentage
+      int batteryPer = get_battery_percent();
       if (get_charge()) {
-        if (!charge_symbol_change)displayImage(216, 0, 24, 24, symbolBattery2);
-        charge_symbol_change = true;
-        int batteryPer = get_battery_percent();
-        String batteryDisplay = "";
         if (batteryPer < 10)
-          batteryDisplay = " " + (String)batteryPer;
+          charge_value.set(" " + (String)batteryPer);
         else
-          batteryDisplay = (String)batteryPer;
-        displayPrintln(222, 8, batteryDisplay, 0x0000, 0xFFFF);
+          charge_value.set((String)batteryPer);
       } else {
-        displayImage(216, 0, 24, 24, symbolBattery1);
-        charge_symbol_change = false;
+        charge_value.hide();
       }
+      percent_value.set((String)batteryPer + "%");
+      percent_bar.set(batteryPer);
+    }
 
-      displayPrintln(10, 120, (String)get_battery_percent() + "%   ", 0xFFFF, 0x0000,3);
+    virtual uint32_t refreshTime()
+    {
+      return 1000;
     }
 
     virtual void up()
@@ -60,6 +61,10 @@ class BatteryScreen : public TheScreen
     }
 
   private:
-    bool charge_symbol_change = false;
+    LabelWidget title = LabelWidget(0, 0, "Battery:");
+    IconWidget charge_icon = IconWidget(216, 0, 24, 24);
+    ValueWidget charge_value = ValueWidget(222, 8, 0x0000, 0xFFFF, 1);
+    ValueWidget percent_value = ValueWidget(10, 120, 0xFFFF, 0x0000, 3);
+    BarWidget percent_bar = BarWidget(10, 160, 220, 16, 100, 0x07E0, 0x2104);
 
 };
@@ -31,5 +31,10 @@ class BootScreen : public TheScreen
 
     }
 
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
+
   private:
 };
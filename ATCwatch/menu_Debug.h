@@ -2,9 +2,11 @@
 #pragma once
 #include "Arduino.h"
 #include "classScreen.h"
+#include "classWidget.h"
 #include "images.h"
 #include "menu.h"
 #include "display.h"
+#include "fast_spi.h"
 #include "menuAppsBase.h"
 #include "ble.h"
 #include "time.h"
@@ -15,23 +17,25 @@
 #include "heartrate.h"
 #include "backlight.h"
 
-class DebugScreen : public TheScreen
+class DebugScreen : public WidgetScreen
 {
   public:
     DebugScreen() {
+      add(&title);
+      add(&uptime_label);
+      add(&millis_value);
+      add(&uptime_value);
+      add(&spi_value);
+      add(&dma_value);
+      add(&reset_value);
+      add(&wakeup_label);
+      add(&wakeup_value);
+      add(&list_value);
+      add(&glyph_value);
+      add(&icon);
     }
 
-    virtual void pre()
-    {
-      displayRect(0, 0, 240, 240, 0x0000);
-      displayPrintln(0, 0, "Debug:", 0xFF00, 0x0000, 2);
-      displayPrintln(0, 20, "Uptime:", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 120 - 16, "Reset: " + (String)NRF_POWER->RESETREAS, 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 120, "Wakeup: ", 0xFFFF, 0x0000, 2);
-      displayImage(120 - (72 / 2), 240 - 72, 72, 72, symbolDebug);
-    }
-
-    virtual void main()
+    virtual void update()
     {
       long days = 0;
       long hours = 0;
@@ -46,12 +50,34 @@ class DebugScreen : public TheScreen
       hours = hours - (days * 24);
 
 
-      displayPrintln(0, 20 + 16, (String)millis() + "      ", 0xFFFF, 0x0000, 2);
-      displayPrintln(0, 20 + 16 + 16, String(days) + " " + (String)hours + ":" + (String)mins + ":" + (String)secs + "     ", 0xFFFF, 0x0000, 2);
-      displayPrintln((9 * 5 * 2), 120, (String)wakeup_reason[get_wakeup_reason()], 0xFFFF, 0x0000, 2);
+      millis_value.set((String)millis());
+      uptime_value.set(String(days) + " " + (String)hours + ":" + (String)mins + ":" + (String)secs);
+      reset_value.set("Reset: " + (String)NRF_POWER->RESETREAS);
+      wakeup_value.set((String)wakeup_reason[get_wakeup_reason()]);
+
+      spi_stats_struct spi_stats = get_spi_frame_stats();
+      spi_value.set("SPI:" + (String)spi_stats.bytes + "B " + (String)spi_stats.bus_us + "us");
+      dma_value.set("DMA:" + (String)spi_stats.transfers + " Win:" + (String)spi_stats.windows);
+      display_list_stats_struct list_stats = get_display_list_stats();
+      list_value.set("Ops:" + (String)list_stats.ops + " Mrg:" + (String)list_stats.merged + " Reg:" + (String)list_stats.regions);
+      glyph_cache_stats_struct glyph_stats = get_glyph_cache_stats();
+      uint32_t lookups = glyph_stats.hits + glyph_stats.misses;
+      glyph_value.set("Glyph:" + (String)(lookups ? glyph_stats.hits * 100 / lookups : 0) + "% Ev:" + (String)glyph_stats.evictions);
     }
 
   private:
     String wakeup_reason[10] = {"Unset", "Push", "Connect", "Disconnect", "Charged", "Charge", "Button", "Touch", "Accl", "AcclINT"};
+    LabelWidget title = LabelWidget(0, 0, "Debug:", 0xFF00);
+    LabelWidget uptime_label = LabelWidget(0, 20, "Uptime:");
+    ValueWidget millis_value = ValueWidget(0, 20 + 16);
+    ValueWidget uptime_value = ValueWidget(0, 20 + 16 + 16);
+    ValueWidget spi_value = ValueWidget(0, 20 + 16 + 16 + 16);
+    ValueWidget dma_value = ValueWidget(0, 20 + 16 + 16 + 16 + 16);
+    ValueWidget reset_value = ValueWidget(0, 120 - 16);
+    LabelWidget wakeup_label = LabelWidget(0, 120, "Wakeup: ");
+    ValueWidget wakeup_value = ValueWidget((9 * 5 * 2), 120);
+    ValueWidget list_value = ValueWidget(0, 120 + 16);
+    ValueWidget glyph_value = ValueWidget(0, 120 + 16 + 16);
+    IconWidget icon = IconWidget(120 - (72 / 2), 240 - 72, 72, 72, symbolDebug);
 
 };
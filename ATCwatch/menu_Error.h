@@ -31,6 +31,11 @@ class ErrorScreen : public TheScreen
     {
 
     }
+
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
     virtual void up()
     {
       display_home();
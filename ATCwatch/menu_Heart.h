@@ -2,6 +2,7 @@
 #pragma once
 #include "Arduino.h"
 #include "class.h"
+#include "classWidget.h"
 #include "images.h"
 #include "menu.h"
 #include "display.h"
@@ -15,22 +16,24 @@
 #include "heartrate.h"
 
 
-class HeartScreen : public TheScreen
+class HeartScreen : public WidgetScreen
 {
   public:
     HeartScreen() {
+      add(&title);
+      add(&hr_value);
+      add(&last_label);
+      add(&last_value);
+      add(&icon);
     }
 
     virtual void pre()
     {
       start_hrs3300();
-      displayRect(0, 0, 240, 240, 0x0000);
-      displayPrintln(0, 0, "Heartrate:", 0xFFFF, 0x0000, 2);
-      displayImage(120 - (72 / 2), 240-72, 72, 72, symbolHeart);
-      displayPrintln(0, 50, "Last HR:", 0xFFFF, 0x0000, 2);
+      WidgetScreen::pre();
     }
 
-    virtual void main()
+    virtual void update()
     {
       byte hr = get_heartrate();
       switch (hr) {
@@ -38,16 +41,16 @@ class HeartScreen : public TheScreen
         case 255:
           break;
         case 254:
-          displayPrintln(0, 20, "No Touch      ", 0xFFFF, 0x0000, 2);
+          hr_value.set("No Touch");
           break;
         case 253:
-          displayPrintln(0, 20, "Please Wait   ", 0xFFFF, 0x0000, 2);
+          hr_value.set("Please Wait");
           break;
         default:
-          displayPrintln(0, 20, (String)hr + "          ", 0xFFFF, 0x0000, 2);
+          hr_value.set((String)hr);
           break;
       }
-      displayPrintln(0, 70, (String)get_last_heartrate() + "   ", 0xFFFF, 0x0000, 2);
+      last_value.set((String)get_last_heartrate());
     }
 
     virtual void post()
@@ -61,6 +64,11 @@ class HeartScreen : public TheScreen
     }
 
   private:
+    LabelWidget title = LabelWidget(0, 0, "Heartrate:");
+    ValueWidget hr_value = ValueWidget(0, 20);
+    LabelWidget last_label = LabelWidget(0, 50, "Last HR:");
+    ValueWidget last_value = ValueWidget(0, 70);
+    IconWidget icon = IconWidget(120 - (72 / 2), 240 - 72, 72, 72, symbolHeart);
 
 
 };
@@ -24,10 +24,18 @@ class HomeScreen : public TheScreen
     {
       displayRect(0, 0, 240, 240, 0x0000);
       charge_symbol_change = false;
+      last_charge = -1;
+      last_ble = -1;
+      reset_text_cache(&time_cache);
+      reset_text_cache(&date_cache);
+      reset_text_cache(&heart_cache);
+      reset_text_cache(&steps_cache);
+      reset_text_cache(&msg_cache);
+      reset_text_cache(&battery_cache);
       if (!is_night()) {
-        displayImage(0, 136, 24, 24, symbolHeartSmall);
-        displayImage(0, 136 + 24 + 2, 24, 24, symbolStepsSmall);
-        displayImage(0, 136 + 24 + 2 + 24 + 2, 24, 24, symbolMsgSmall);
+        displayImageIndexed(0, 136, 24, 24, symbolHeartSmall);
+        displayImageIndexed(0, 136 + 24 + 2, 24, 24, symbolStepsSmall);
+        displayImageIndexed(0, 136 + 24 + 2 + 24 + 2, 24, 24, symbolMsgSmall);
       }
     }
 
@@ -48,22 +56,33 @@ class HomeScreen : public TheScreen
       sprintf(time_string, "%02i:%02i:%02i", time_data.hr, time_data.min, time_data.sec);
       char date_string[14];
       sprintf(date_string, "%02i.%02i.%04i", time_data.day, time_data.month, time_data.year);
-      displayPrintln(0, 56, time_string, textcolor, bgcolor, 5);
-      displayPrintln(28, 104, date_string, textcolor, bgcolor, 3);
+      //only the digits that changed since the last frame are drawn
+      displayPrintlnCached(0, 56, time_string, &time_cache, textcolor, bgcolor, 5);
+      displayPrintlnCached(28, 104, date_string, &date_cache, textcolor, bgcolor, 3);
 
-      displayPrintln(30, 140, (String)get_last_heartrate() + "     ", textcolor, bgcolor, 2);
-      displayPrintln(30, 140 + 24 + 2, (String)accl_data.steps + "     ", textcolor, bgcolor, 2);
-      displayPrintln(30, 140 + 24 + 2 + 24 + 2, get_push_msg(17), textcolor, bgcolor, 2);
+      displayPrintlnCached(30, 140, (String)get_last_heartrate(), &heart_cache, textcolor, bgcolor, 2);
+      displayPrintlnCached(30, 140 + 24 + 2, (String)accl_data.steps, &steps_cache, textcolor, bgcolor, 2);
+      displayPrintlnCached(30, 140 + 24 + 2 + 24 + 2, get_push_msg(17), &msg_cache, textcolor, bgcolor, 2);
 
       if (!is_night()) {
-        if (get_vars_ble_connected())
-          displayImage(176, 0, 24, 24, symbolBle1);
-        else
-          displayImage(176, 0, 24, 24, symbolBle2);
+        bool ble_connected = get_vars_ble_connected();
+        if (ble_connected != last_ble) {
+          last_ble = ble_connected;
+          if (ble_connected)
+            displayImageIndexed(176, 0, 24, 24, symbolBle1);
+          else
+            displayImageIndexed(176, 0, 24, 24, symbolBle2);
+        }
       }
 
-
-      if (get_charge()) {
+      bool charging = get_charge();
+      if (charging != last_charge) {//the percentage and the battery symbol use the same corner
+        last_charge = charging;
+        displayRect(204, 0, 36, 24, 0x0000);
+        reset_text_cache(&battery_cache);
+        if (!charging)displayImageIndexed(216, 0, 24, 24, symbolBattery1);
+      }
+      if (charging) {
         int batteryPer = get_battery_percent();
         String batteryDisplay = "";
 
@@ -72,7 +91,7 @@ class HomeScreen : public TheScreen
         else if (batteryPer > 20) bgbattery = 0xFC00; //orange
         else bgbattery = 0xF800; //red
         if (!charge_symbol_change) {
-          //displayImage(216, 0, 24, 24, symbolBattery2);
+          //displayImageIndexed(216, 0, 24, 24, symbolBattery2);
           //displayRect(216, 0, 24, 24, bgbattery);
         }
         charge_symbol_change = true;
@@ -83,9 +102,8 @@ class HomeScreen : public TheScreen
         }
         batteryDisplay = (String)batteryPer + "%";
         //displayPrintln(200, 0, batteryDisplay, 0x0000, bgbattery, 2); //black text, colorful bg
-        displayPrintln(204, 0, batteryDisplay, bgbattery, 0x0000, 2); //colorful text, black bg
+        displayPrintlnCached(204, 0, batteryDisplay, &battery_cache, bgbattery, 0x0000, 2); //colorful text, black bg
       } else {
-        displayImage(216, 0, 24, 24, symbolBattery1);
         charge_symbol_change = false;
       }
     }
@@ -106,7 +124,20 @@ class HomeScreen : public TheScreen
     virtual void right()
     {
     }
+
+    virtual uint32_t colorBits()
+    {
+      return 12;
+    }
   private:
     bool charge_symbol_change = false;
+    int8_t last_charge = -1;
+    int8_t last_ble = -1;
+    text_cache_struct time_cache;
+    text_cache_struct date_cache;
+    text_cache_struct heart_cache;
+    text_cache_struct steps_cache;
+    text_cache_struct msg_cache;
+    text_cache_struct battery_cache;
 
 };
@@ -14,6 +14,12 @@
 #include "heartrate.h"
 
 
+#define NOTIFY_TOP 10
+#define NOTIFY_LINES 9
+#define NOTIFY_LINE_HEIGHT 16
+#define NOTIFY_LINE_GLYPHS 20//what displayPrintln fits in one line at size 2
+#define NOTIFY_SCROLL_LINES 3
+
 class NotifyScreen : public TheScreen
 {
   public:
@@ -22,9 +28,10 @@ class NotifyScreen : public TheScreen
 
     virtual void pre()
     {
+      set_display_scroll_area(NOTIFY_TOP, NOTIFY_LINES * NOTIFY_LINE_HEIGHT);//long notifications scroll between title and icon
       displayRect(0, 0, 240, 240, 0x0000);
       displayPrintln(0, 0, "Notification:");
-      displayImage(120 - (72 / 2), 240-72, 72, 72, symbolMsg);
+      displayImageRLE(120 - (72 / 2), 240-72, 72, 72, symbolMsg);
     }
 
     virtual void main()
@@ -32,14 +39,35 @@ class NotifyScreen : public TheScreen
       String notification = get_push_msg();
       if (last_notification != notification) {
         last_notification = notification;
-        displayRect(0, 9, 240, (150 - 9), 0x0000);
-        displayPrintln(0, 10, notification, 0xFFFF, 0x0000, 2);
+        num_lines = (countGlyphs() + NOTIFY_LINE_GLYPHS - 1) / NOTIFY_LINE_GLYPHS;
+        first_line = 0;
+        shown_line = 0;
+        drawLines(0, NOTIFY_LINES);
+      } else if (first_line != shown_line) {
+        int32_t lines = first_line - shown_line;
+        scroll_display(lines * NOTIFY_LINE_HEIGHT);
+        shown_line = first_line;
+        if (lines > 0)
+          drawLines(NOTIFY_LINES - lines, NOTIFY_LINES);
+        else
+          drawLines(0, -lines);
       }
     }
 
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
+
+    virtual uint32_t colorBits()
+    {
+      return 12;
+    }
+
     virtual void post()
     {
       last_notification = "";
+      set_display_scroll_area(0, DISPLAY_GRAM_ROWS);
     }
     virtual void long_click()
     {
@@ -58,11 +86,20 @@ class NotifyScreen : public TheScreen
 
     virtual void up()
     {
-      display_home();
+      if (first_line + NOTIFY_LINES >= num_lines) {
+        display_home();
+        return;
+      }
+      first_line += NOTIFY_SCROLL_LINES;
+      if (first_line + NOTIFY_LINES > num_lines)first_line = num_lines - NOTIFY_LINES;
     }
     virtual void down()
     {
-      display_home();
+      if (!first_line) {
+        display_home();
+        return;
+      }
+      first_line = first_line > NOTIFY_SCROLL_LINES ? first_line - NOTIFY_SCROLL_LINES : 0;
     }
 
     virtual void click(touch_data_struct touch_data)
@@ -72,4 +109,43 @@ class NotifyScreen : public TheScreen
 
   private:
     String last_notification = "";
+    int32_t num_lines = 0;
+    int32_t first_line = 0;
+    int32_t shown_line = 0;
+
+    uint32_t countGlyphs()
+    {
+      const unsigned char *chars = (const unsigned char *)last_notification.c_str();
+      uint32_t len = last_notification.length();
+      uint32_t used;
+      uint32_t glyphs = 0;
+      for (uint32_t f = 0; f < len; f += used)
+        if (decodeUtf8(&chars[f], len - f, &used) >= 0)glyphs++;
+      return glyphs;
+    }
+
+    String getLine(uint32_t line)
+    {
+      const unsigned char *chars = (const unsigned char *)last_notification.c_str();
+      uint32_t len = last_notification.length();
+      uint32_t used;
+      uint32_t glyphs = 0;
+      uint32_t start = len;
+      for (uint32_t f = 0; f < len; f += used) {
+        if (decodeUtf8(&chars[f], len - f, &used) < 0)continue;
+        if (glyphs == line * NOTIFY_LINE_GLYPHS)start = f;
+        if (glyphs == (line + 1) * NOTIFY_LINE_GLYPHS)return last_notification.substring(start, f);
+        glyphs++;
+      }
+      return last_notification.substring(start);
+    }
+
+    void drawLines(int32_t from, int32_t to)
+    {
+      for (int32_t i = from; i < to; i++) {
+        uint32_t y = NOTIFY_TOP + i * NOTIFY_LINE_HEIGHT;
+        displayRect(0, y, 240, NOTIFY_LINE_HEIGHT, 0x0000);
+        displayPrintln(0, y, getLine(shown_line + i), 0xFFFF, 0x0000, 2);
+      }
+    }
 };
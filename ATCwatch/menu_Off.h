@@ -31,6 +31,11 @@ class OffScreen : public TheScreen
 
     }
 
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
+
     virtual void click(touch_data_struct touch_data)
     {
       switch (checkYesNoButtonClick(touch_data.xpos, touch_data.ypos)) {
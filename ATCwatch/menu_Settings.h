@@ -2,6 +2,7 @@
 #pragma once
 #include "Arduino.h"
 #include "class.h"
+#include "classWidget.h"
 #include "images.h"
 #include "menu.h"
 #include "display.h"
@@ -12,38 +13,43 @@
 #include "accl.h"
 #include "push.h"
 #include "heartrate.h"
+#include "sleep.h"
 
 
-class SettingsScreen : public TheScreen
+class SettingsScreen : public WidgetScreen
 {
   public:
     SettingsScreen() {
+      add(&title);
+      add(&charge_icon);
+      add(&charge_value);
+      add(&always_on_label);
+      add(&always_on_value);
+      add(&always_on_light_label);
+      add(&always_on_light_value);
     }
 
-    virtual void pre()
-    {
-      charge_symbol_change = false;
-      displayRect(0, 0, 240, 240, 0x0000);
-      displayPrintln(0, 0, "Settings:", 0xFFFF, 0x0000, 2);
-    }
-
-    virtual void main()
+    virtual void update()
     {
+      if (charge_icon.set(get_charge() ? symbolBattery2 : symbolBattery1))
+        charge_value.invalidate();//the icon was drawn over the percentage
+      int batteryPer = get_battery_percent();
       if (get_charge()) {
-        if (!charge_symbol_change)displayImage(216, 0, 24, 24, symbolBattery2);
-        charge_symbol_change = true;
-        int batteryPer = get_battery_percent();
-        String batteryDisplay = "";
         if (batteryPer < 10)
-          batteryDisplay = " " + (String)batteryPer;
+          charge_value.set(" " + (String)batteryPer);
         else
-          batteryDisplay = (String)batteryPer;
-        displayPrintln(222, 8, batteryDisplay, 0x0000, 0xFFFF);
+          charge_value.set((String)batteryPer);
       } else {
-        displayImage(216, 0, 24, 24, symbolBattery1);
-        charge_symbol_change = false;
+        charge_value.hide();
       }
+      always_on_value.set(get_always_on() ? "On" : "Off");
+      always_on_light_value.set(get_always_on_light() ? "On" : "Off");
+    }
 
+    virtual uint32_t refreshTime()
+    {
+      if (get_charge())return 1000;//only the charge percentage changes, plugging in or out invalidates the screen
+      return NO_REFRESH_TIME;
     }
 
     virtual void up()
@@ -58,7 +64,19 @@ class SettingsScreen : public TheScreen
       set_backlight();
     }
 
+    virtual void click(touch_data_struct touch_data)
+    {
+      if (touch_data.ypos >= 32 && touch_data.ypos < 64)set_always_on(!get_always_on());
+      if (touch_data.ypos >= 64 && touch_data.ypos < 96)set_always_on_light(!get_always_on_light());
+    }
+
   private:
-    bool charge_symbol_change = false;
+    LabelWidget title = LabelWidget(0, 0, "Settings:");
+    IconWidget charge_icon = IconWidget(216, 0, 24, 24);
+    ValueWidget charge_value = ValueWidget(222, 8, 0x0000, 0xFFFF, 1);
+    LabelWidget always_on_label = LabelWidget(0, 40, "Always on:");
+    ValueWidget always_on_value = ValueWidget(132, 40);
+    LabelWidget always_on_light_label = LabelWidget(0, 72, "AOD light:");
+    ValueWidget always_on_light_value = ValueWidget(132, 72);
 
 };
@@ -30,6 +30,11 @@ class UpdateScreen : public TheScreen
     {
 
     }
+
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
     virtual void right()
     {
       set_last_menu();
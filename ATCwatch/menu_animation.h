@@ -21,10 +21,12 @@ class AnimationScreen : public TheScreen
     virtual void pre()
     {
       currentSymbol = 0;
+      lastChange = millis();
       displayRect(0, 0, 240, 240, 0x0000);
       displayPrintln(0, 0, "Animation Test", 0xFFFF, 0x0000, 2);
       displayPrintln(0, 16, "Speed:", 0xFFFF, 0x0000, 2);
       displayPrintln(0, 32, String(speedChange) + " ms    ", 0xFFFF, 0x0000, 2);
+      displayImageRLE(x, y, w, h, symbolNian);//every frame after this one only sends what changed
     }
 
     virtual void up()
@@ -45,43 +47,14 @@ class AnimationScreen : public TheScreen
 
     virtual void main()
     {
-      switch (currentSymbol) {
-        case 1:
-          displayImage(x, y, w, h, symbolNian1);
-          break;
-        case 2:
-          displayImage(x, y, w, h,  symbolNian2);
-          break;
-        case 3:
-          displayImage(x, y, w, h,  symbolNian3);
-          break;
-        case 4:
-          displayImage(x, y, w, h,  symbolNian4);
-          break;
-        case 5:
-          displayImage(x, y, w, h,  symbolNian5);
-          break;
-        case 6:
-          displayImage(x, y, w, h,  symbolNian6);
-          break;
-        case 7:
-          displayImage(x, y, w, h,  symbolNian7);
-          break;
-        case 8:
-          displayImage(x, y, w, h, symbolNian8);
-          break;
-        default:
-          currentSymbol = 1;
-          break;
-      }
-
-      if (millis() - lastChange > speedChange) {
+      if (millis() - lastChange > (uint32_t)speedChange) {
         lastChange = millis();
 
-        if (currentSymbol >= 8)
+        if (currentSymbol >= 7)
           currentSymbol = 0;
         else
           currentSymbol++;
+        displayImageDelta(x, y, frames[currentSymbol]);
       }
     }
 
@@ -92,7 +65,8 @@ class AnimationScreen : public TheScreen
 
   private:
     int x = 50, y = 70, w = 120, h = 76;
-    int currentSymbol = 1;
+    int currentSymbol = 0;
+    const uint16_t *frames[8] = {symbolNianDelta1, symbolNianDelta2, symbolNianDelta3, symbolNianDelta4, symbolNianDelta5, symbolNianDelta6, symbolNianDelta7, symbolNianDelta8};
     long lastChange;
     int speedChange = 100;
 
@@ -30,7 +30,7 @@ class InfosScreen : public TheScreen
       MyID += tmp;
 
       displayRect(0, 0, 240, 240, 0x0000);
-      displayImage(120 - (72 / 2), 240 - 72, 72, 72, symbolInfos);
+      displayImageRLE(120 - (72 / 2), 240 - 72, 72, 72, symbolInfos);
       displayPrintln(0, 0, "Infos:", 0xFFFF, 0x0000, 2);
       displayPrintln(0, 16 + 2, "Firmware By:", 0xFFFF, 0x0000, 2);
       displayPrintln(0, 16 + 16 + 5, "   ATCnetz.de", 0xFFFF, 0x0000, 2);
@@ -47,6 +47,11 @@ class InfosScreen : public TheScreen
 
     }
 
+    virtual uint32_t refreshTime()
+    {
+      return NO_REFRESH_TIME;
+    }
+
   private:
 
 };
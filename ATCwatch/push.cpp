@@ -14,10 +14,7 @@ void init_push() {
 void show_push(String pushMSG) {
   int commaIndex = pushMSG.indexOf(',');
   int secondCommaIndex = pushMSG.indexOf(',', commaIndex + 1);
-  int lastCommaIndex = pushMSG.indexOf(',', secondCommaIndex + 1);
-  String MsgText = pushMSG.substring(commaIndex + 1, secondCommaIndex);
-  int timeShown = pushMSG.substring(secondCommaIndex + 1, lastCommaIndex).toInt();
-  int SymbolNr = pushMSG.substring(lastCommaIndex + 1).toInt();
+  String MsgText = pushMSG.substring(commaIndex + 1, secondCommaIndex);//the time shown and the symbol after it are not used
   msgText = MsgText;
   sleep_up(WAKEUP_BLEPUSH);
   display_notify();
@@ -27,15 +24,16 @@ void show_push(String pushMSG) {
 }
 
 String get_push_msg(int returnLength) {
-  if (returnLength != 0 || msgText.length() == returnLength) {
-    if (msgText.length() < returnLength) {
+  int length = msgText.length();
+  if (returnLength != 0 || length == returnLength) {
+    if (length < returnLength) {
       String tempText = msgText;
-      int toSmall = returnLength - msgText.length();
+      int toSmall = returnLength - length;
       for (int i = 0; i < toSmall; i++) {
         tempText += " ";
       }
       return tempText;
-    } else if (msgText.length() > returnLength)
+    } else if (length > returnLength)
       return msgText.substring(0, returnLength - 3) + "...";
   }
   return msgText;
@@ -15,6 +15,8 @@
 
 bool sleep_enable = false;
 bool sleep_sleeping = false;
+bool always_on = false;
+bool always_on_light = true;//dimmed backlight for the always on clock, see AlwaysOnScreen
 int wakeup_reason = 0;
 long lastaction = 0;
 volatile bool i2cReading = false;
@@ -40,6 +42,7 @@ bool sleep_up(int reason) {
     set_sleep_time();
     display_enable(true);
     set_backlight();
+    if (always_on)display_home();//leaving the always on screen restores the normal display mode
     return true;
   }
   return false;
@@ -57,14 +60,33 @@ int get_wakeup_reason() {
   return wakeup_reason;
 }
 
+void set_always_on(bool state) {
+  always_on = state;
+}
+
+bool get_always_on() {
+  return always_on;
+}
+
+void set_always_on_light(bool state) {
+  always_on_light = state;
+}
+
+bool get_always_on_light() {
+  return always_on_light;
+}
+
 void disable_hardware() {
   set_backlight(0);
-  display_home();
+  if (always_on)
+    display_always_on();
+  else
+    display_home();
   display_screen(true);
   end_hrs3300();
   set_led(0);
   set_motor(0);
-  display_enable(false);
+  if (!always_on)display_enable(false);
   NRF_SAADC ->ENABLE = 0; //disable ADC
   NRF_PWM0  ->ENABLE = 0; //disable all pwm instance
   NRF_PWM1  ->ENABLE = 0;
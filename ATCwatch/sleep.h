@@ -20,6 +20,10 @@ bool sleep_up(int reason = 0);
 void sleep_down();
 int get_wakeup_reason();
 void disable_hardware();
+void set_always_on(bool state);
+bool get_always_on();
+void set_always_on_light(bool state);
+bool get_always_on_light();
 void sleep_wait();
 void set_sleep_time();
 void check_sleep_times();
@@ -52,6 +52,14 @@ String GetDateTimeString() {
   return datetime;
 }
 
+uint32_t get_timestamp() {
+  return now();
+}
+
+void set_timestamp(uint32_t timestamp) {
+  setTime(timestamp);
+}
+
 bool is_night() {
   time_data_struct time_data = get_time();
   if (time_data.hr >= 23 || time_data.hr < 7) {
@@ -17,3 +17,5 @@ void init_time();
 time_data_struct get_time();
 void SetDateTimeString(String datetime);
 String GetDateTimeString();
+uint32_t get_timestamp();
+void set_timestamp(uint32_t timestamp);
@@ -0,0 +1,110 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "ble.h"
+#include <time.h>
+
+//dispatch latency of one received command: the old filterCmd() chain of String compares and substring()
+//against the hashed handler table. Both end in the same handlers, their time alone is measured as well
+//and taken off, what is left is finding the handler
+//usage: bench_ble_cmd [calls]
+
+void cmd_bond(const char *argument, uint32_t length);
+void cmd_act(const char *argument, uint32_t length);
+void cmd_run(const char *argument, uint32_t length);
+void cmd_user(const char *argument, uint32_t length);
+void cmd_pace(const char *argument, uint32_t length);
+void cmd_batt(const char *argument, uint32_t length);
+void cmd_push(const char *argument, uint32_t length);
+void cmd_bt_ver(const char *argument, uint32_t length);
+void cmd_ver(const char *argument, uint32_t length);
+void cmd_sn(const char *argument, uint32_t length);
+void cmd_contrast(const char *argument, uint32_t length);
+void cmd_motor(const char *argument, uint32_t length);
+void cmd_set_time(const char *argument, uint32_t length);
+void cmd_time(const char *argument, uint32_t length);
+
+void old_call(void (*handler)(const char *argument, uint32_t length), String argument) {
+  handler(argument.c_str(), argument.length());
+}
+
+//the old chain without BT+UPGB and BT+RESET, nothing here is allowed to reboot
+void old_filterCmd(String Command) {
+  if (Command == "AT+BOND") {
+    old_call(cmd_bond, "");
+  } else if (Command == "AT+ACT") {
+    old_call(cmd_act, "");
+  } else if (Command.substring(0, 7) == "BT+UPGB") {
+  } else if (Command.substring(0, 8) == "BT+RESET") {
+  } else if (Command.substring(0, 7) == "AT+RUN=") {
+    old_call(cmd_run, Command.substring(7));
+  } else if (Command.substring(0, 8) == "AT+USER=") {
+    old_call(cmd_user, Command.substring(8));
+  } else if (Command == "AT+PACE") {
+    old_call(cmd_pace, "");
+  } else if (Command == "AT+BATT") {
+    old_call(cmd_batt, "");
+  } else if (Command.substring(0, 8) == "AT+PUSH=") {
+    old_call(cmd_push, Command.substring(8));
+  } else if (Command == "BT+VER") {
+    old_call(cmd_bt_ver, "");
+  } else if (Command == "AT+VER") {
+    old_call(cmd_ver, "");
+  } else if (Command == "AT+SN") {
+    old_call(cmd_sn, "");
+  } else if (Command.substring(0, 12) == "AT+CONTRAST=") {
+    old_call(cmd_contrast, Command.substring(12));
+  } else if (Command.substring(0, 10) == "AT+MOTOR=1") {
+    old_call(cmd_motor, Command.substring(10));
+  } else if (Command.substring(0, 6) == "AT+DT=") {
+    old_call(cmd_set_time, Command.substring(6));
+  } else if (Command.substring(0, 5) == "AT+DT") {
+    old_call(cmd_time, Command.substring(5));
+  }
+}
+
+struct bench_command_struct {
+  const char *command;
+  uint32_t nameLength;
+  void (*handler)(const char *argument, uint32_t length);//NULL for commands that are not known
+};
+
+const bench_command_struct bench_commands[] = {
+  {"AT+PUSH=0,Hello from the phone,5,1", 8, cmd_push},
+  {"AT+PACE", 7, cmd_pace},
+  {"AT+BATT", 7, cmd_batt},
+  {"AT+DT", 5, cmd_time},
+  {"AT+DT=20261017081500", 6, cmd_set_time},
+  {"AT+CONTRAST=175", 12, cmd_contrast},
+  {"BT+VER", 6, cmd_bt_ver},
+  {"AT+XYZ", 0, NULL},
+};
+
+double bench_seconds() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int host_main(int argc, char **argv) {
+  const uint32_t calls = argc > 1 ? atoi(argv[1]) : 200000;
+  printf("ns per command, dispatch is the time without the handler\n");
+  printf("%-36s %8s %8s %8s %9s %9s\n", "command", "old", "table", "handler", "old disp", "table disp");
+  for (uint32_t i = 0; i < sizeof(bench_commands) / sizeof(bench_commands[0]); i++) {
+    const bench_command_struct *c = &bench_commands[i];
+    uint32_t length = strlen(c->command);
+    String command = c->command;
+    double start = bench_seconds();
+    for (uint32_t n = 0; n < calls; n++)old_filterCmd(command);
+    double old = (bench_seconds() - start) * 1e9 / calls;
+    start = bench_seconds();
+    for (uint32_t n = 0; n < calls; n++)filterCmd(c->command, length);
+    double table = (bench_seconds() - start) * 1e9 / calls;
+    start = bench_seconds();
+    if (c->handler)
+      for (uint32_t n = 0; n < calls; n++)c->handler(c->command + c->nameLength, length - c->nameLength);
+    double handler = (bench_seconds() - start) * 1e9 / calls;
+    printf("%-36s %8.1f %8.1f %8.1f %9.1f %9.1f\n", c->command, old, table, handler, old - handler, table - handler);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "ble_rx.h"
+#include <time.h>
+
+//commands per second out of 20 byte writes: the old ble_written() that appended every write to a String
+//and cut the command out with substring(), against ble_rx_push() and the views from ble_rx_next()
+//usage: bench_ble_rx [rounds]
+
+String old_answer = "";
+String old_tempCmd = "";
+int old_tempLen = 0, old_tempLen1;
+uint32_t old_commands;
+
+void old_ble_written(const uint8_t *value, int length) {
+  char remoteCharArray[22];
+  old_tempLen1 = length;
+  old_tempLen = old_tempLen + old_tempLen1;
+  memset(remoteCharArray, 0, sizeof(remoteCharArray));
+  memcpy(remoteCharArray, value, old_tempLen1);
+  old_tempCmd = old_tempCmd + remoteCharArray;
+  if (old_tempCmd[old_tempLen - 2] == '\r' && old_tempCmd[old_tempLen - 1] == '\n') {
+    old_answer = old_tempCmd.substring(0, old_tempLen - 2);
+    old_tempCmd = "";
+    old_tempLen = 0;
+    old_commands++;
+  }
+}
+
+double bench_seconds() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int host_main(int argc, char **argv) {
+  static const char *commands[] = {
+    "AT+PACE\r\n",
+    "AT+BATT\r\n",
+    "AT+PUSH=0,Hello from the phone, this is a longer text,5,1\r\n",
+    "AT+DT=20261017081500\r\n",
+  };
+  const uint32_t count = sizeof(commands) / sizeof(commands[0]);
+  const uint32_t rounds = argc > 1 ? atoi(argv[1]) : 200000;
+  uint32_t bytes = 0;
+  for (uint32_t i = 0; i < count; i++)bytes += strlen(commands[i]);
+
+  double start = bench_seconds();
+  for (uint32_t n = 0; n < rounds; n++) {
+    const char *command = commands[n % count];
+    int length = strlen(command);
+    for (int pos = 0; pos < length; pos += 20)old_ble_written((const uint8_t *)command + pos, length - pos < 20 ? length - pos : 20);
+  }
+  double middle = bench_seconds();
+  uint32_t newCommands = 0;
+  volatile uint32_t sink = 0;
+  ble_rx_reset();
+  for (uint32_t n = 0; n < rounds; n++) {
+    const char *command = commands[n % count];
+    int length = strlen(command);
+    for (int pos = 0; pos < length; pos += 20) {
+      ble_rx_push((const uint8_t *)command + pos, length - pos < 20 ? length - pos : 20);
+      ble_command_struct rx;
+      while (ble_rx_next(&rx)) {
+        sink += rx.length;
+        newCommands++;
+      }
+    }
+  }
+  double end = bench_seconds();
+  printf("%u commands, %.1f bytes each\n", rounds, (float)bytes / count);
+  printf("String   %10.0f commands/s %7.1f ns/command\n", old_commands / (middle - start), (middle - start) * 1e9 / old_commands);
+  printf("ble_rx   %10.0f commands/s %7.1f ns/command\n", newCommands / (end - middle), (end - middle) * 1e9 / newCommands);
+  return old_commands != rounds || newCommands != rounds;
+}
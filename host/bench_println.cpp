@@ -0,0 +1,90 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "font57cz.h"
+
+//bus cost of one displayPrintln() call: the old drawChar() that sent a displayRect() per font pixel
+//against the glyph cells sent as one window, both drawn outside a frame so every call goes to the bus.
+//Both use today's window setup, so the difference is only the glyph path
+
+void old_drawChar(uint32_t x, uint32_t y, unsigned char c, uint16_t color, uint16_t bg, uint32_t size) {
+  for (int8_t i = 0; i < 5; i++) {
+    uint8_t line = font57[c * 5 + i];
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if (line & 1) {
+        displayRect(x + i * size, y + j * size, size, size, color);
+      } else if (bg != color) {
+        displayRect(x + i * size, y + j * size, size, size, bg);
+      }
+    }
+  }
+  if (bg != color) {
+    displayRect(x + 5 * size, y, size, 8 * size, bg);
+  }
+}
+
+void old_displayPrintln(uint32_t x, uint32_t y, String text, uint16_t color, uint16_t bg, uint32_t size) {
+  const unsigned char *chars = (const unsigned char *)text.c_str();
+  uint32_t used;
+  int position = 0;
+  for (uint32_t f = 0; f < text.length(); f += used) {
+    int16_t glyph = decodeUtf8(&chars[f], text.length() - f, &used);
+    if (glyph < 0)continue;
+    if (x + (position * 6 * size) >= 234) {
+      x = -(position * 6 * size);
+      y += 8 * size;
+    }
+    old_drawChar(x + (position * 6 * size), y, glyph, color, bg, size);
+    position++;
+  }
+}
+
+struct bench_case_struct {
+  const char *name;
+  uint32_t x, y;
+  const char *text;
+  uint32_t size;
+};
+
+const bench_case_struct bench_cases[] = {
+  {"clock", 0, 56, "08:00:00", 5},
+  {"date", 28, 104, "17.10.2026", 3},
+  {"steps", 30, 166, "4321", 2},
+  {"notify line", 0, 16, "Meeting moved to 3pm", 2},
+  {"title", 0, 0, "Notification:", 1},
+};
+
+void bench_row(const char *name, const char *variant, const emu_stats_struct *stats) {
+  printf("%-12s %-7s %9u %6u %8u %8u %8u\n", name, variant, stats->cpu_starts, stats->parts, stats->windows, stats->bytes, emu_bus_us(stats));
+}
+
+int host_main(int argc, char **argv) {
+  static uint16_t before[EMU_WIDTH * EMU_HEIGHT], after[EMU_WIDTH * EMU_HEIGHT];
+  uint32_t mismatches = 0;
+  init_fast_spi();
+  init_display();
+  printf("%-12s %-7s %9s %6s %8s %8s %8s\n", "text", "drawn", "transfers", "parts", "windows", "bytes", "bus us");
+  for (uint32_t i = 0; i < sizeof(bench_cases) / sizeof(bench_cases[0]); i++) {
+    const bench_case_struct &c = bench_cases[i];
+    display_clear();
+    emu_reset_stats();
+    old_displayPrintln(c.x, c.y, c.text, 0xFFFF, 0x0000, c.size);
+    emu_stats_struct stats = emu_get_stats();
+    bench_row(c.name, "before", &stats);
+    emu_screen(before);
+
+    display_clear();
+    emu_reset_stats();
+    displayPrintln(c.x, c.y, c.text, 0xFFFF, 0x0000, c.size);
+    stats = emu_get_stats();
+    bench_row(c.name, "after", &stats);
+    emu_screen(after);
+    if (memcmp(before, after, sizeof(before))) {
+      printf("%s: the screens differ\n", c.name);
+      mismatches++;
+    }
+  }
+  return mismatches || emu_errors();
+}
@@ -0,0 +1,73 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "pinout.h"
+
+//CPU work per transfer: the old write_fast_spi() started and polled every 255 byte part, the list mode
+//starts once and lets PPI 9/10/11 and TIMER3 restart the DMA until the last whole part
+
+uint8_t bench_buffer[15000];
+
+void old_write_fast_spi(uint8_t *ptr, uint32_t len) {
+  int v2 = 0;
+  do
+  {
+    NRF_SPIM2->EVENTS_END = 0;
+    NRF_SPIM2->EVENTS_ENDRX = 0;
+    NRF_SPIM2->EVENTS_ENDTX = 0;
+    NRF_SPIM2->TXD.PTR = (uint32_t)(uintptr_t) ptr + v2;
+    if ( len <= 0xFF )
+    {
+      NRF_SPIM2->TXD.MAXCNT = len;
+      v2 += len;
+      len = 0;
+    }
+    else
+    {
+      NRF_SPIM2->TXD.MAXCNT = 255;
+      v2 += 255;
+      len -= 255;
+    }
+    NRF_SPIM2->RXD.PTR = 0;
+    NRF_SPIM2->RXD.MAXCNT = 0;
+    NRF_SPIM2->TASKS_START = 1;
+    while (NRF_SPIM2->EVENTS_END == 0);
+    NRF_SPIM2->EVENTS_END = 0;
+  }
+  while ( len );
+}
+
+void bench_row(uint32_t length, const char *variant, const emu_stats_struct *stats) {
+  printf("%8u %-7s %9u %6u %10u %8u\n", length, variant, stats->cpu_starts, stats->parts, stats->interrupts, emu_bus_us(stats));
+}
+
+int host_main(int argc, char **argv) {
+  static const uint32_t lengths[] = {300, 510, 1000, 7680, 15000};
+  uint32_t failures = 0;
+  init_fast_spi();
+  init_display();
+  printf("%8s %-7s %9s %6s %10s %8s\n", "bytes", "sent", "transfers", "parts", "interrupts", "bus us");
+  digitalWrite(LCD_RS, HIGH);
+  digitalWrite(LCD_CS, LOW);
+  for (uint32_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+    emu_reset_stats();
+    old_write_fast_spi(bench_buffer, lengths[i]);
+    emu_stats_struct before = emu_get_stats();
+    bench_row(lengths[i], "polled", &before);
+    emu_reset_stats();
+    write_fast_spi(bench_buffer, lengths[i]);
+    emu_stats_struct after = emu_get_stats();
+    bench_row(lengths[i], "list", &after);
+    if (after.bytes != lengths[i] || before.bytes != lengths[i])failures++;
+  }
+  digitalWrite(LCD_CS, HIGH);
+
+  //a full screen clear, the case the list was made for
+  emu_reset_stats();
+  displayRect(0, 0, 240, 240, 0x0000);
+  emu_stats_struct clear = emu_get_stats();
+  printf("full screen rect: %u transfers, %u parts, %u interrupts, %u bytes\n", clear.cpu_starts, clear.parts, clear.interrupts, clear.bytes);
+  return failures || emu_errors();
+}
@@ -0,0 +1,197 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include <time.h>
+
+//decoding Czech and German notification text: the old drawChar() remap that kept the lead byte in globals
+//and switched over the second byte, against decodeUtf8() and its tables. Both have to give the same glyphs
+
+bool old_last_uni_char = false;
+unsigned char old_last_char;
+
+int16_t old_decodeChar(unsigned char c) {
+  if (c < 32)return -1;
+  if (c >= 127) {
+    if (!old_last_uni_char) {
+      old_last_char = c;
+      old_last_uni_char = true;
+      return -1;
+    } else {
+      old_last_uni_char = false;
+      if (old_last_char == 0xC3) {    //remap UTF-8 characters to 8-bit encoding
+        switch (c) {
+          case 0x84://Ä
+            c = 0x8E;
+            break;
+          case 0xA4://ä
+            c = 0x84;
+            break;
+          case 0x96://Ö
+            c = 0x99;
+            break;
+          case 0xB6://ö
+            c = 0x94;
+            break;
+          case 0x9C://Ü
+            c = 0x9A;
+            break;
+          case 0xBC://ü
+            c = 0x81;
+            break;
+          case 0x9F://ß
+            c = 0xE1;
+            break;
+
+          case 0x81://Á
+            c = 0xB5;
+            break;
+          case 0xA1://á
+            c = 0xA0;
+            break;
+          case 0x89://É
+            c = 0x90;
+            break;
+          case 0xA9://é
+            c = 0x82;
+            break;
+          case 0x8D://Í
+            c = 0xD6;
+            break;
+          case 0xAD://í
+            c = 0xA1;
+            break;
+          case 0x93://Ó
+            c = 0xE0;
+            break;
+          case 0xB3://ó
+            c = 0xA2;
+            break;
+          case 0x9A://Ú
+            c = 0xE9;
+            break;
+          case 0xBA://ú
+            c = 0xA3;
+            break;
+          case 0x9D://Ý
+            c = 0xED;
+            break;
+          case 0xBD://ý
+            c = 0xEC;
+            break;
+          default:
+            return -1;
+            break;
+        }
+      } else if (old_last_char == 0xC4) {
+        switch (c) {
+          case 0x8C://Č
+            c = 0x80;
+            break;
+          case 0x8D://č
+            c = 0x87;
+            break;
+          case 0x8E://Ď
+            c = 0x9D;
+            break;
+          case 0x8F://ď
+            c = 0x9B;
+            break;
+          case 0x9A://Ě
+            c = 0xD2;
+            break;
+          case 0x9B://ě
+            c = 0x88;
+            break;
+          default:
+            return -1;
+            break;
+        }
+      } else if (old_last_char == 0xC5) {
+        switch (c) {
+          case 0xAE://Ů
+            c = 0xEA;
+            break;
+          case 0xAF://ů
+            c = 0x96;
+            break;
+          case 0x87://Ň
+            c = 0xA5;
+            break;
+          case 0x88://ň
+            c = 0xA4;
+            break;
+          case 0x98://Ř
+            c = 0x92;
+            break;
+          case 0x99://ř
+            c = 0x91;
+            break;
+          case 0xA0://Š
+            c = 0xB6;
+            break;
+          case 0xA1://š
+            c = 0x83;
+            break;
+          case 0xA4://Ť
+            c = 0xD7;
+            break;
+          case 0xA5://ť
+            c = 0x8C;
+            break;
+          case 0xBD://Ž
+            c = 0xE2;
+            break;
+          case 0xBE://ž
+            c = 0x93;
+            break;
+          default:
+            return -1;
+            break;
+        }
+      } else if (old_last_char == 0xF0 && c == 0x9F)
+        c = 0x02;
+      else
+        return -1;
+    }
+  }
+  return c;
+}
+
+double bench_seconds() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int host_main(int argc, char **argv) {
+  const char *sample = "Příliš žluťoučký kůň úpěl ďábelské ódy. Größe Übermäßig schön, Grüße aus Köln! ";
+  const unsigned char *text = (const unsigned char *)sample;
+  uint32_t len = strlen(sample);
+  int16_t oldGlyphs[128], newGlyphs[128];
+  uint32_t oldCount = 0, newCount = 0;
+  uint32_t used;
+  for (uint32_t i = 0; i < len; i++) {
+    int16_t glyph = old_decodeChar(text[i]);
+    if (glyph >= 0)oldGlyphs[oldCount++] = glyph;
+  }
+  for (uint32_t i = 0; i < len; i += used) {
+    int16_t glyph = decodeUtf8(&text[i], len - i, &used);
+    if (glyph >= 0)newGlyphs[newCount++] = glyph;
+  }
+  bool same = oldCount == newCount && !memcmp(oldGlyphs, newGlyphs, oldCount * sizeof(oldGlyphs[0]));
+
+  const uint32_t rounds = argc > 1 ? atoi(argv[1]) : 200000;
+  volatile int32_t sink = 0;
+  double start = bench_seconds();
+  for (uint32_t n = 0; n < rounds; n++)
+    for (uint32_t i = 0; i < len; i++)sink += old_decodeChar(text[i]);
+  double middle = bench_seconds();
+  for (uint32_t n = 0; n < rounds; n++)
+    for (uint32_t i = 0; i < len; i += used)sink += decodeUtf8(&text[i], len - i, &used);
+  double end = bench_seconds();
+  printf("%u bytes, %u glyphs, %s\n", len, newCount, same ? "same glyphs" : "the glyphs differ");
+  printf("old remap   %.2f ns/byte\n", (middle - start) * 1e9 / rounds / len);
+  printf("decodeUtf8  %.2f ns/byte\n", (end - middle) * 1e9 / rounds / len);
+  return !same;
+}
@@ -0,0 +1,66 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "pinout.h"
+
+//bus transactions per window: the old setAddrWindowDisplay() sent CASET, RASET and RAMWR with spiCommand(),
+//each one a single byte DMA between two LCD_RS writes, against the one five part list with D/C toggled by GPIOTE.
+//Random windows take the list, windows of a few pixels like a glyph row stay with the single byte commands
+
+void old_spiCommand(uint8_t d) {
+  digitalWrite(LCD_RS, LOW);
+  write_fast_spi(&d, 1);
+  digitalWrite(LCD_RS, HIGH);
+}
+
+void old_setAddrWindowDisplay(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  uint8_t temp[4];
+  old_spiCommand(0x2A);
+  temp[0] = 0x00;
+  temp[1] = x;
+  temp[2] = 0x00;
+  temp[3] = (x + w - 1);
+  write_fast_spi(temp, 4);
+  old_spiCommand(0x2B);
+  temp[0] = 0x00;
+  temp[1] = y;
+  temp[2] = 0x00;
+  temp[3] = ((y + h - 1) & 0xFF);
+  write_fast_spi(temp, 4);
+  old_spiCommand(0x2C);
+}
+
+void bench_row(const char *windowSet, const char *variant, uint32_t windows, const emu_stats_struct *stats) {
+  printf("%-7s %-7s %9.1f %6.1f %6.1f %10.1f %6.1f %7.2f\n", windowSet, variant, (float)stats->cpu_starts / windows, (float)stats->parts / windows,
+         (float)stats->gpio_writes / windows, (float)stats->dc_toggles / windows, (float)stats->bytes / windows, (float)emu_bus_us(stats) / windows);
+}
+
+int host_main(int argc, char **argv) {
+  uint32_t windows = argc > 1 ? atoi(argv[1]) : 1000;
+  init_fast_spi();
+  init_display();
+  printf("per window, %u windows, the list from %u pixel bytes\n", windows, DISPLAY_WINDOW_LIST_BYTES);
+  printf("%-7s %-7s %9s %6s %6s %10s %6s %7s\n", "windows", "setup", "transfers", "parts", "gpio", "dc toggles", "bytes", "bus us");
+  for (int small = 0; small < 2; small++) {
+    for (int variant = 0; variant < 2; variant++) {
+      uint32_t seed = 1;
+      emu_reset_stats();
+      startWrite();
+      for (uint32_t i = 0; i < windows; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t x = (seed >> 8) % 232, y = (seed >> 16) % 232;
+        uint32_t w = 1 + (seed >> 4) % (small ? 8 : 240 - x), h = 1 + (seed >> 12) % (small ? 8 : 240 - y);
+        if (variant)setAddrWindowDisplay(x, y, w, h);
+        else old_setAddrWindowDisplay(x, y, w, h);
+      }
+      endWrite();
+      emu_stats_struct stats = emu_get_stats();
+      bench_row(small ? "glyph" : "random", variant ? "now" : "before", windows, &stats);
+      if (stats.windows != windows)printf("%u of %u windows reached the panel\n", stats.windows, windows);
+    }
+  }
+  if (emu_errors())printf("emulator errors: %u, first: %s\n", emu_errors(), emu_first_error());
+  return emu_errors() != 0;
+}
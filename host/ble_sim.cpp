@@ -0,0 +1,82 @@
+#include <BLEPeripheral.h>
+
+//the stack model behind include/BLEPeripheral.h. By default 7 notification buffers of which 2 are sent
+//per connection event and one write of the central per event, the tests change them in ble_sim
+ble_sim_struct ble_sim = {false, 7, 7, 2, 1, 0, 0, 0, {}, 0, {}, {}, 0, 0, NULL, NULL, NULL, NULL};
+
+void ble_sim_connect() {
+  BLECentral central;
+  ble_sim.connected = true;
+  ble_sim.free_buffers = ble_sim.max_buffers;
+  if (ble_sim.on_connect)ble_sim.on_connect(central);
+}
+
+void ble_sim_disconnect() {
+  BLECentral central;
+  ble_sim.connected = false;
+  ble_sim.write_tail = ble_sim.write_head;
+  if (ble_sim.on_disconnect)ble_sim.on_disconnect(central);
+}
+
+void ble_sim_write(const char *text) {
+  ble_sim_write_data((const uint8_t *)text, strlen(text));
+}
+
+void ble_sim_write_data(const uint8_t *data, uint32_t length) {
+  for (uint32_t pos = 0; pos < length && ble_sim.write_head - ble_sim.write_tail < BLE_SIM_WRITES; pos += BLE_SIM_PACKET) {
+    uint32_t part = length - pos < BLE_SIM_PACKET ? length - pos : BLE_SIM_PACKET;
+    uint32_t slot = ble_sim.write_head++ % BLE_SIM_WRITES;
+    memcpy(ble_sim.writes[slot], data + pos, part);
+    ble_sim.write_lengths[slot] = part;
+  }
+}
+
+uint32_t ble_sim_pending_writes() {
+  return ble_sim.write_head - ble_sim.write_tail;
+}
+
+void BLECharacteristic::setEventHandler(BLEEvent event, BLECharacteristicEventHandler handler) {
+  if (event != BLEWritten)return;
+  ble_sim.rx = this;
+  ble_sim.rx_handler = handler;
+}
+
+bool BLECharacteristic::setValue(const unsigned char *value, unsigned char length) {
+  if (length > BLE_SIM_PACKET)length = BLE_SIM_PACKET;
+  if (!(_properties & BLENotify)) {
+    memcpy(_value, value, length);
+    _length = length;
+    return true;
+  }
+  if (!ble_sim.connected || !ble_sim.free_buffers) {
+    ble_sim.rejected++;
+    return false;
+  }
+  ble_sim.free_buffers--;
+  ble_sim.notifications++;
+  for (uint32_t i = 0; i < length && ble_sim.air_length < BLE_SIM_AIR; i++)
+    ble_sim.air[ble_sim.air_length++] = value[i];
+  return true;
+}
+
+bool BLECharacteristic::canNotify() {
+  return ble_sim.connected && ble_sim.free_buffers;
+}
+
+void BLEPeripheral::setEventHandler(BLEEvent event, BLEPeripheralEventHandler handler) {
+  if (event == BLEConnected)ble_sim.on_connect = handler;
+  else if (event == BLEDisconnected)ble_sim.on_disconnect = handler;
+}
+
+void BLEPeripheral::poll() {
+  ble_sim.polls++;
+  if (!ble_sim.connected)return;
+  ble_sim.free_buffers += ble_sim.done_per_poll;
+  if (ble_sim.free_buffers > ble_sim.max_buffers)ble_sim.free_buffers = ble_sim.max_buffers;
+  for (uint32_t i = 0; i < ble_sim.writes_per_poll && ble_sim.write_tail != ble_sim.write_head; i++) {
+    BLECentral central;
+    uint32_t slot = ble_sim.write_tail++ % BLE_SIM_WRITES;
+    ble_sim.rx->setValue(ble_sim.writes[slot], ble_sim.write_lengths[slot]);
+    if (ble_sim.rx_handler)ble_sim.rx_handler(central, *ble_sim.rx);
+  }
+}
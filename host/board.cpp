@@ -0,0 +1,184 @@
+#include "board.h"
+
+#include "battery.h"
+#include "backlight.h"
+#include "heartrate.h"
+#include "sleep.h"
+#include "bootloader.h"
+#include "inputoutput.h"
+
+//stand-ins for the Arduino core and for the modules that talk to hardware, so the display, menu
+//and BLE modules link on the host. Nothing here tries to model the real parts
+board_struct board = {0, 1792224000, {0, 0, 0, 25, 4321, 0, 0, 0, false}, 80, 3.95, false, 72, {}, false, 0, 0, 0, true};
+
+int board_pins[64];
+
+void emu_gpio_write(uint32_t pin, uint32_t value) __attribute__((weak));
+
+unsigned long millis() {
+  return board.ms;
+}
+
+unsigned long micros() {
+  return board.ms * 1000UL;
+}
+
+void delay(unsigned long ms) {
+  board.ms += ms;
+}
+
+void delayMicroseconds(unsigned int us) {}
+
+void pinMode(uint32_t pin, uint32_t mode) {}
+
+void digitalWrite(uint32_t pin, uint32_t value) {
+  board_pins[pin & 63] = value;
+  if (emu_gpio_write)emu_gpio_write(pin, value);
+}
+
+int digitalRead(uint32_t pin) {
+  return board_pins[pin & 63];
+}
+
+accl_data_struct get_accl_data() {
+  return board.accl;
+}
+
+void reset_step_counter() {
+  board.accl.steps = 0;
+}
+
+int get_battery_percent() {
+  return board.battery_percent;
+}
+
+float get_battery() {
+  return board.battery_volts;
+}
+
+bool get_charge() {
+  return board.charging;
+}
+
+void set_backlight() {}
+
+void set_backlight(int brightness) {
+  board.backlight = brightness;
+}
+
+int get_backlight() {
+  return board.backlight;
+}
+
+void dim_backlight() {}
+
+void inc_backlight() {
+  board.backlight++;
+}
+
+void dec_backlight() {
+  board.backlight--;
+}
+
+void start_hrs3300() {}
+
+void end_hrs3300() {}
+
+byte get_heartrate() {
+  return board.heartrate;
+}
+
+byte get_last_heartrate() {
+  return board.heartrate;
+}
+
+time_data_struct get_time() {
+  uint32_t days = board.timestamp / 86400;
+  uint32_t seconds = board.timestamp % 86400;
+  //civil date from days since 1970
+  uint32_t z = days + 719468;
+  uint32_t era = z / 146097;
+  uint32_t doe = z - era * 146097;
+  uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  uint32_t mp = (5 * doy + 2) / 153;
+  time_data_struct time_data;
+  time_data.day = doy - (153 * mp + 2) / 5 + 1;
+  time_data.month = mp < 10 ? mp + 3 : mp - 9;
+  time_data.year = yoe + era * 400 + (time_data.month <= 2);
+  time_data.hr = seconds / 3600;
+  time_data.min = (seconds / 60) % 60;
+  time_data.sec = seconds % 60;
+  return time_data;
+}
+
+bool is_night() {
+  time_data_struct time_data = get_time();
+  return time_data.hr >= 22 || time_data.hr < 8;
+}
+
+uint32_t get_timestamp() {
+  return board.timestamp;
+}
+
+void set_timestamp(uint32_t timestamp) {
+  board.timestamp = timestamp;
+}
+
+void SetDateTimeString(String datetime) {}
+
+String GetDateTimeString() {
+  time_data_struct t = get_time();
+  char text[16];
+  snprintf(text, sizeof(text), "%04i%02i%02i%02i%02i%02i", t.year, t.month, t.day, t.hr, t.min, t.sec);
+  return text;
+}
+
+touch_data_struct get_touch() {
+  return board.touch;
+}
+
+bool sleep_up(int reason) {
+  board.wakeup_reason = reason;
+  return true;
+}
+
+int get_wakeup_reason() {
+  return board.wakeup_reason;
+}
+
+void set_always_on(bool state) {
+  board.always_on = state;
+}
+
+bool get_always_on() {
+  return board.always_on;
+}
+
+void set_always_on_light(bool state) {
+  board.always_on_light = state;
+}
+
+bool get_always_on_light() {
+  return board.always_on_light;
+}
+
+void set_sleep_time() {}
+
+void start_bootloader(bool without_sd) {
+  board.reboots++;
+}
+
+void set_reboot() {
+  board.reboots++;
+}
+
+void system_off() {}
+
+void set_motor_power(int ms) {}
+
+void set_motor_ms() {}
+
+void set_motor_ms(int ms) {}
+
+void set_led_ms(int ms) {}
@@ -0,0 +1,25 @@
+#pragma once
+
+//values the stand-ins in board.cpp report in place of the sensors, the RTC and the touch panel
+#include "Arduino.h"
+#include "accl.h"
+#include "time.h"
+#include "touch.h"
+
+struct board_struct {
+  uint32_t ms;//millis(), moved on by delay() and by the programs
+  uint32_t timestamp;//seconds since 1970 for get_time() and get_timestamp()
+  accl_data_struct accl;
+  int battery_percent;
+  float battery_volts;
+  bool charging;
+  uint8_t heartrate;
+  touch_data_struct touch;
+  bool always_on;
+  int wakeup_reason;
+  int backlight;
+  uint32_t reboots;
+  bool always_on_light;
+};
+
+extern board_struct board;
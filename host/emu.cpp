@@ -0,0 +1,553 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "pinout.h"
+#include "display.h"
+#include <signal.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+extern "C" void SPIM2_SPIS2_SPI2_IRQHandler(void);
+extern "C" void TIMER3_IRQHandler(void);
+
+NRF_SPIM_Type emu_spim;
+NRF_GPIOTE_Type emu_gpiote;
+NRF_PPI_Type emu_ppi;
+NRF_TIMER_Type emu_timer[3];
+NRF_POWER_Type emu_power;
+NRF_FICR_Type emu_ficr = {{0x12345678, 0xC0DE}};
+
+NRF_SPIM_Type *NRF_SPIM2 = &emu_spim;
+NRF_GPIOTE_Type *NRF_GPIOTE = &emu_gpiote;
+NRF_PPI_Type *NRF_PPI = &emu_ppi;
+NRF_TIMER_Type *NRF_TIMER1 = &emu_timer[0];
+NRF_TIMER_Type *NRF_TIMER2 = &emu_timer[1];
+NRF_TIMER_Type *NRF_TIMER3 = &emu_timer[2];
+NRF_POWER_Type *NRF_POWER = &emu_power;
+NRF_FICR_Type *NRF_FICR = &emu_ficr;
+
+struct emu_panel_struct {
+  uint16_t gram[EMU_GRAM_ROWS * EMU_WIDTH];
+  uint8_t command;
+  uint8_t args[16];
+  uint32_t argCount;
+  uint32_t xs, xe, ys, ye;
+  uint32_t x, y;
+  uint32_t colmod;
+  uint8_t pixel[3];
+  uint32_t pixelBytes;
+  bool partial;
+  uint32_t partialStart, partialEnd;
+  bool idle;
+  bool on;
+  uint32_t scrollTop, scrollRows, scrollStart;//VSCRDEF and VSCSAD
+};
+
+emu_panel_struct emu_panel;
+emu_stats_struct emu_stats;
+uint32_t emu_bus = EMU_BUS_IMMEDIATE;
+bool emu_irq[64];
+uint32_t emu_gpiote_out[8];
+uint32_t emu_timer_count;
+bool emu_timer_running;
+bool emu_timer_irq;
+uint32_t emu_spim_inten;
+void (*emu_scroll_hook)();
+emu_trace_struct *emu_trace_buffer;
+uint32_t emu_trace_size, emu_trace_count;
+uint32_t emu_error_count;
+char emu_error_text[160];
+
+//a latched transfer, started but not clocked out yet
+volatile sig_atomic_t emu_pending;
+volatile sig_atomic_t emu_in_model;
+uint32_t emu_pending_ptr, emu_pending_length;
+bool emu_finishing;
+
+void emu_error(const char *text, uint32_t value = 0) {
+  if (!emu_error_count++)snprintf(emu_error_text, sizeof(emu_error_text), "%s (%u)", text, value);
+}
+
+uint32_t emu_address(volatile void *reg) {
+  return (uint32_t)(uintptr_t)reg;
+}
+
+//ST7789
+void emu_pixel(uint16_t color) {
+  emu_panel_struct &p = emu_panel;
+  if (p.x < EMU_WIDTH && p.y < EMU_GRAM_ROWS)p.gram[p.y * EMU_WIDTH + p.x] = color;
+  if (++p.x > p.xe) {
+    p.x = p.xs;
+    if (++p.y > p.ye)p.y = p.ys;
+  }
+}
+
+uint16_t emu_expand12(uint32_t r, uint32_t g, uint32_t b) {
+  return (r << 1 | r >> 3) << 11 | (g << 2 | g >> 2) << 5 | (b << 1 | b >> 3);
+}
+
+void emu_panel_data(uint8_t data) {
+  emu_panel_struct &p = emu_panel;
+  if (p.command == ST77XX_RAMWR || p.command == 0x3C) {
+    p.pixel[p.pixelBytes++] = data;
+    if (p.colmod == 3) {//two pixels in three bytes, the first one is complete after the second byte
+      if (p.pixelBytes == 2)emu_pixel(emu_expand12(p.pixel[0] >> 4, p.pixel[0] & 15, p.pixel[1] >> 4));
+      if (p.pixelBytes == 3) {
+        emu_pixel(emu_expand12(p.pixel[1] & 15, p.pixel[2] >> 4, p.pixel[2] & 15));
+        p.pixelBytes = 0;
+      }
+    } else if (p.pixelBytes == 2) {
+      emu_pixel(p.pixel[0] << 8 | p.pixel[1]);
+      p.pixelBytes = 0;
+    }
+    return;
+  }
+  if (p.argCount < sizeof(p.args))p.args[p.argCount] = data;
+  p.argCount++;
+  switch (p.command) {
+    case ST77XX_CASET:
+      if (p.argCount == 4) {
+        p.xs = p.args[0] << 8 | p.args[1];
+        p.xe = p.args[2] << 8 | p.args[3];
+        if (p.xe < p.xs || p.xe >= EMU_WIDTH)emu_error("bad CASET", p.xs << 16 | p.xe);
+      }
+      break;
+    case ST77XX_RASET:
+      if (p.argCount == 4) {
+        p.ys = p.args[0] << 8 | p.args[1];
+        p.ye = p.args[2] << 8 | p.args[3];
+        if (p.ye < p.ys || p.ye >= EMU_GRAM_ROWS)emu_error("bad RASET", p.ys << 16 | p.ye);
+      }
+      break;
+    case ST77XX_PTLAR:
+      if (p.argCount == 4) {
+        p.partialStart = p.args[0] << 8 | p.args[1];
+        p.partialEnd = p.args[2] << 8 | p.args[3];
+      }
+      break;
+    case ST77XX_COLMOD:
+      if (p.argCount == 1)p.colmod = data & 7;
+      break;
+    case ST77XX_VSCRDEF:
+      if (p.argCount == 6) {
+        p.scrollTop = p.args[0] << 8 | p.args[1];
+        p.scrollRows = p.args[2] << 8 | p.args[3];
+        uint32_t bottom = p.args[4] << 8 | p.args[5];
+        if (p.scrollTop + p.scrollRows + bottom != EMU_GRAM_ROWS || !p.scrollRows)emu_error("bad VSCRDEF", p.scrollTop << 16 | p.scrollRows);
+      }
+      break;
+    case ST77XX_VSCSAD:
+      if (p.argCount == 2) {
+        p.scrollStart = p.args[0] << 8 | p.args[1];
+        if (p.scrollStart < p.scrollTop || p.scrollStart >= p.scrollTop + p.scrollRows)emu_error("VSCSAD outside the scroll area", p.scrollStart);
+        if (emu_scroll_hook)emu_scroll_hook();
+      }
+      break;
+  }
+}
+
+void emu_panel_command(uint8_t command) {
+  emu_panel_struct &p = emu_panel;
+  p.command = command;
+  p.argCount = 0;
+  p.pixelBytes = 0;
+  if (command == ST77XX_NOP) {
+    emu_stats.nops++;
+    return;
+  }
+  emu_stats.commands++;
+  switch (command) {
+    case ST77XX_RAMWR:
+      emu_stats.windows++;
+      p.x = p.xs;
+      p.y = p.ys;
+      break;
+    case ST77XX_PTLON:
+      p.partial = true;
+      break;
+    case ST77XX_NORON:
+      p.partial = false;
+      break;
+    case ST77XX_IDMON:
+      p.idle = true;
+      break;
+    case ST77XX_IDMOFF:
+      p.idle = false;
+      break;
+    case ST77XX_DISPON:
+      p.on = true;
+      break;
+    case ST77XX_DISPOFF:
+      p.on = false;
+      break;
+  }
+}
+
+//memory row the panel shows on screen row y, rows in the scroll area start at VSCSAD and wrap inside it
+uint32_t emu_visible_row(uint32_t y) {
+  const emu_panel_struct &p = emu_panel;
+  if (y < p.scrollTop || y >= p.scrollTop + p.scrollRows || !p.scrollRows)return y;
+  return p.scrollTop + (p.scrollStart - p.scrollTop + y - p.scrollTop) % p.scrollRows;
+}
+
+bool emu_dc() {
+  for (int n = 0; n < 8; n++) {//a GPIOTE task channel owns its pin
+    uint32_t config = emu_gpiote.CONFIG[n].value;
+    if ((config & 3) == GPIOTE_CONFIG_MODE_Task && ((config >> GPIOTE_CONFIG_PSEL_Pos) & 31) == LCD_RS)return emu_gpiote_out[n];
+  }
+  return digitalRead(LCD_RS);
+}
+
+void emu_panel_byte(uint8_t data) {
+  bool dc = emu_dc();
+  if (digitalRead(LCD_CS)) {
+    emu_error("byte sent with CS high", data);
+    return;
+  }
+  emu_stats.bytes++;
+  if (emu_trace_buffer && emu_trace_count < emu_trace_size)emu_trace_buffer[emu_trace_count++] = {data, dc};
+  if (dc)emu_panel_data(data);
+  else emu_panel_command(data);
+}
+
+//PPI, TIMER and GPIOTE
+void emu_task(uint32_t address);
+
+void emu_event(volatile uint32_t *event) {
+  uint32_t address = emu_address(event);
+  for (int c = 0; c < 20; c++)
+    if ((emu_ppi.CHEN & (1U << c)) && emu_ppi.CH[c].EEP == address)emu_task(emu_ppi.CH[c].TEP);
+}
+
+void emu_timer_task(NRF_TIMER_Type *timer, uint32_t address) {
+  if (timer != NRF_TIMER3)return;//only the list counter is modelled
+  if (address == emu_address(&timer->TASKS_START))emu_timer_running = true;
+  else if (address == emu_address(&timer->TASKS_STOP))emu_timer_running = false;
+  else if (address == emu_address(&timer->TASKS_CLEAR))emu_timer_count = 0;
+  else if (address == emu_address(&timer->TASKS_COUNT) && emu_timer_running) {
+    if (timer->MODE != TIMER_MODE_MODE_Counter)emu_error("TIMER3 counted outside counter mode");
+    emu_timer_count = (emu_timer_count + 1) & 0xFFFF;
+    for (int i = 0; i < 6; i++) {
+      if (emu_timer_count != timer->CC[i])continue;
+      timer->EVENTS_COMPARE[i] = 1;
+      if (timer->INTENSET.value & (TIMER_INTENSET_COMPARE0_Msk << i))emu_timer_irq = true;
+      emu_event(&timer->EVENTS_COMPARE[i]);
+    }
+  }
+}
+
+void emu_spim_start(bool cpu);
+
+void emu_task(uint32_t address) {
+  if (address == emu_address(&emu_spim.TASKS_START)) {
+    emu_spim_start(false);
+    return;
+  }
+  for (int t = 0; t < 3; t++)
+    if (address >= emu_address(&emu_timer[t]) && address < emu_address(&emu_timer[t] + 1)) {
+      emu_timer_task(&emu_timer[t], address);
+      return;
+    }
+  for (int n = 0; n < 8; n++) {
+    if (address != emu_address(&emu_gpiote.TASKS_OUT[n]))continue;
+    uint32_t config = emu_gpiote.CONFIG[n].value;
+    if ((config & 3) != GPIOTE_CONFIG_MODE_Task)return;
+    uint32_t polarity = (config >> GPIOTE_CONFIG_POLARITY_Pos) & 3;
+    uint32_t level = polarity == GPIOTE_CONFIG_POLARITY_Toggle ? !emu_gpiote_out[n] : polarity == GPIOTE_CONFIG_POLARITY_LoToHi;
+    if (level != emu_gpiote_out[n] && ((config >> GPIOTE_CONFIG_PSEL_Pos) & 31) == LCD_RS)emu_stats.dc_toggles++;
+    emu_gpiote_out[n] = level;
+    return;
+  }
+  for (int g = 0; g < 6; g++) {
+    if (address == emu_address(&emu_ppi.TASKS_CHG[g].EN))emu_ppi.CHEN |= emu_ppi.CHG[g];
+    if (address == emu_address(&emu_ppi.TASKS_CHG[g].DIS))emu_ppi.CHEN &= ~emu_ppi.CHG[g];
+  }
+}
+
+//SPIM2
+void emu_spim_start(bool cpu) {
+  if (cpu)emu_stats.cpu_starts++;
+  if (emu_pending)emu_error("TASKS_START while a transfer runs", emu_spim.TXD.PTR);
+  emu_pending_ptr = emu_spim.TXD.PTR;
+  emu_pending_length = emu_spim.TXD.MAXCNT;
+  emu_pending = 1;
+  if (emu_bus != EMU_BUS_IMMEDIATE || emu_finishing)return;
+  while (emu_pending)emu_spim_finish();
+}
+
+void emu_interrupts() {
+  if ((emu_spim_inten & SPIM_INTENSET_END_Msk) && emu_spim.EVENTS_END && emu_irq[SPIM2_SPIS2_SPI2_IRQn]) {
+    emu_stats.interrupts++;
+    SPIM2_SPIS2_SPI2_IRQHandler();
+  }
+  if (emu_timer_irq && emu_irq[TIMER3_IRQn]) {
+    emu_timer_irq = false;
+    emu_stats.interrupts++;
+    TIMER3_IRQHandler();
+  }
+}
+
+void emu_spim_finish() {
+  if (!emu_pending)return;
+  bool nested = emu_finishing;
+  emu_finishing = true;
+  const uint8_t *data = (const uint8_t *)(uintptr_t)emu_pending_ptr;
+  uint32_t length = emu_pending_length;
+  emu_pending = 0;
+  emu_stats.parts++;
+  if (!data && length)emu_error("DMA from address 0");
+  for (uint32_t i = 0; i < length; i++)emu_panel_byte(data[i]);
+  emu_spim.TXD.AMOUNT = length;
+  if (emu_spim.TXD.LIST == SPIM_TXD_LIST_LIST_ArrayList)emu_spim.TXD.PTR += length;
+  emu_spim.EVENTS_ENDTX = 1;
+  emu_spim.EVENTS_END = 1;
+  emu_event(&emu_spim.EVENTS_END);
+  emu_interrupts();
+  emu_finishing = nested;
+}
+
+void emu_register_write(volatile void *reg, uint32_t value) {
+  emu_in_model = 1;
+  nrf_hooked_register *r = (nrf_hooked_register *)reg;
+  uint32_t address = emu_address(reg);
+  if (reg == &emu_spim.TASKS_START) {
+    if (value)emu_spim_start(true);
+  } else if (reg == &emu_spim.INTENSET) {
+    emu_spim_inten |= value;
+  } else if (reg == &emu_spim.INTENCLR) {
+    emu_spim_inten &= ~value;
+  } else if (reg == &emu_ppi.CHENSET) {
+    for (int c = 0; c < 20; c++)
+      if ((value & (1U << c)) && (!emu_ppi.CH[c].EEP || !emu_ppi.CH[c].TEP))emu_error("PPI channel enabled without EEP and TEP", c);
+    emu_ppi.CHEN |= value;
+  } else if (reg == &emu_ppi.CHENCLR) {
+    emu_ppi.CHEN &= ~value;
+  } else if (address >= emu_address(&emu_gpiote.CONFIG[0]) && address < emu_address(&emu_gpiote.RESERVED[8])) {
+    uint32_t n = r - emu_gpiote.CONFIG;
+    if (n >= 8)emu_error("GPIOTE CONFIG past channel 7", n);
+    r->value = value;
+    if ((value & 3) == GPIOTE_CONFIG_MODE_Task && n < 8)emu_gpiote_out[n] = (value >> GPIOTE_CONFIG_OUTINIT_Pos) & 1;
+  } else {
+    for (int t = 0; t < 3; t++) {
+      if (reg == &emu_timer[t].INTENSET)emu_timer[t].INTENSET.value |= value;
+      else if (reg == &emu_timer[t].INTENCLR)emu_timer[t].INTENSET.value &= ~value;
+    }
+    if (value)emu_task(address);
+  }
+  emu_in_model = 0;
+}
+
+bool emu_spim_pending(uint32_t *ptr, uint32_t *length) {
+  if (ptr)*ptr = emu_pending_ptr;
+  if (length)*length = emu_pending_length;
+  return emu_pending;
+}
+
+void emu_alarm(int signal) {
+  if (emu_pending && !emu_in_model)emu_spim_finish();
+}
+
+void emu_set_bus(uint32_t mode) {
+  struct itimerval timer = {};
+  emu_bus = mode;
+  if (mode == EMU_BUS_ASYNC) {
+    signal(SIGALRM, emu_alarm);
+    timer.it_interval.tv_usec = 50;
+    timer.it_value.tv_usec = 50;
+  }
+  setitimer(ITIMER_REAL, &timer, NULL);
+  if (mode == EMU_BUS_IMMEDIATE)
+    while (emu_pending)emu_spim_finish();
+}
+
+void NVIC_SetPriority(int irq, uint32_t priority) {}
+
+void NVIC_EnableIRQ(int irq) {
+  emu_irq[irq] = true;
+}
+
+void NVIC_DisableIRQ(int irq) {
+  emu_irq[irq] = false;
+}
+
+void NVIC_ClearPendingIRQ(int irq) {}
+
+void NVIC_SystemReset() {
+  emu_error("NVIC_SystemReset");
+}
+
+uint32_t sd_app_evt_wait() {
+  return 0;
+}
+
+bool emu_irq_enabled(int irq) {
+  return emu_irq[irq];
+}
+
+//called by board.cpp for every digitalWrite()
+void emu_gpio_write(uint32_t pin, uint32_t value) {
+  emu_stats.gpio_writes++;
+  if ((pin == LCD_RS || pin == LCD_CS) && emu_pending)emu_error("LCD_RS or LCD_CS changed during a transfer", pin);
+}
+
+void emu_reset() {
+  emu_reset_stats();
+  emu_error_count = 0;
+  emu_error_text[0] = 0;
+  emu_trace_count = 0;
+}
+
+void emu_reset_stats() {
+  memset(&emu_stats, 0, sizeof(emu_stats));
+}
+
+emu_stats_struct emu_get_stats() {
+  return emu_stats;
+}
+
+uint32_t emu_bus_us(const emu_stats_struct *stats) {
+  return stats->bytes * 8 / EMU_SPI_MHZ;
+}
+
+const uint16_t *emu_gram() {
+  return emu_panel.gram;
+}
+
+void emu_screen(uint16_t *pixels) {
+  const emu_panel_struct &p = emu_panel;
+  for (uint32_t y = 0; y < EMU_HEIGHT; y++) {
+    for (uint32_t x = 0; x < EMU_WIDTH; x++) {
+      uint16_t color = p.gram[emu_visible_row(y) * EMU_WIDTH + x];
+      if (!p.on || (p.partial && (y < p.partialStart || y > p.partialEnd)))color = 0;
+      if (p.idle)color = (color & 0x8000 ? 0xF800 : 0) | (color & 0x0400 ? 0x07E0 : 0) | (color & 0x0010 ? 0x001F : 0);
+      pixels[y * EMU_WIDTH + x] = color;
+    }
+  }
+}
+
+void emu_trace(emu_trace_struct *buffer, uint32_t size) {
+  emu_trace_buffer = buffer;
+  emu_trace_size = size;
+  emu_trace_count = 0;
+}
+
+uint32_t emu_trace_length() {
+  return emu_trace_count;
+}
+
+void emu_on_scroll(void (*hook)()) {
+  emu_scroll_hook = hook;
+}
+
+uint32_t emu_scroll_start() {
+  return emu_panel.scrollStart;
+}
+
+uint32_t emu_errors() {
+  return emu_error_count;
+}
+
+const char *emu_first_error() {
+  return emu_error_text;
+}
+
+//PNG with stored deflate blocks, no zlib needed
+uint32_t emu_crc_table[256];
+
+uint32_t emu_crc(uint32_t crc, const uint8_t *data, uint32_t length) {
+  if (!emu_crc_table[1])
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++)c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      emu_crc_table[n] = c;
+    }
+  crc = ~crc;
+  for (uint32_t i = 0; i < length; i++)crc = emu_crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+void emu_put32(std::string &out, uint32_t value) {
+  for (int i = 3; i >= 0; i--)out += (char)(value >> (i * 8));
+}
+
+void emu_chunk(FILE *file, const char *type, const std::string &data) {
+  std::string chunk(type);
+  chunk += data;
+  std::string length;
+  emu_put32(length, data.size());
+  std::string crc;
+  emu_put32(crc, emu_crc(0, (const uint8_t *)chunk.data(), chunk.size()));
+  fwrite(length.data(), 1, 4, file);
+  fwrite(chunk.data(), 1, chunk.size(), file);
+  fwrite(crc.data(), 1, 4, file);
+}
+
+bool emu_write_png(const char *name) {
+  static uint16_t pixels[EMU_WIDTH * EMU_HEIGHT];
+  emu_screen(pixels);
+  std::string raw;
+  for (uint32_t y = 0; y < EMU_HEIGHT; y++) {
+    raw += (char)0;//no filter
+    for (uint32_t x = 0; x < EMU_WIDTH; x++) {
+      uint16_t c = pixels[y * EMU_WIDTH + x];
+      raw += (char)((c >> 11) << 3 | (c >> 13));
+      raw += (char)(((c >> 5) & 63) << 2 | ((c >> 9) & 3));
+      raw += (char)((c & 31) << 3 | ((c >> 2) & 7));
+    }
+  }
+  std::string zlib("\x78\x01", 2);
+  uint32_t a = 1, b = 0;
+  for (size_t i = 0; i < raw.size(); i++) {
+    a = (a + (uint8_t)raw[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  for (size_t pos = 0; pos < raw.size(); pos += 65535) {
+    size_t length = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+    zlib += (char)(pos + length == raw.size());
+    zlib += (char)length;
+    zlib += (char)(length >> 8);
+    zlib += (char)~length;
+    zlib += (char)(~length >> 8);
+    zlib.append(raw, pos, length);
+  }
+  emu_put32(zlib, b << 16 | a);
+  std::string header;
+  emu_put32(header, EMU_WIDTH);
+  emu_put32(header, EMU_HEIGHT);
+  header += std::string("\x08\x02\x00\x00\x00", 5);
+  FILE *file = fopen(name, "wb");
+  if (!file)return false;
+  fwrite("\x89PNG\r\n\x1a\n", 1, 8, file);
+  emu_chunk(file, "IHDR", header);
+  emu_chunk(file, "IDAT", zlib);
+  emu_chunk(file, "IEND", "");
+  fclose(file);
+  return true;
+}
+
+//host_main() runs on this stack so buffers on the stack have 32 bit addresses like on the watch
+#define EMU_STACK_SIZE (16 << 20)
+uint8_t emu_stack[EMU_STACK_SIZE] __attribute__((aligned(16)));
+ucontext_t emu_main_context, emu_firmware_context;
+int emu_argc, emu_result;
+char **emu_argv;
+
+void emu_run() {
+  emu_result = host_main(emu_argc, emu_argv);
+}
+
+int main(int argc, char **argv) {
+  if ((uintptr_t)&emu_stack[EMU_STACK_SIZE] >> 32 || (uintptr_t)&emu_spim >> 32) {
+    fprintf(stderr, "emu: link with -no-pie, the firmware keeps addresses in 32 bits\n");
+    return 2;
+  }
+  emu_argc = argc;
+  emu_argv = argv;
+  getcontext(&emu_firmware_context);
+  emu_firmware_context.uc_stack.ss_sp = emu_stack;
+  emu_firmware_context.uc_stack.ss_size = EMU_STACK_SIZE;
+  emu_firmware_context.uc_link = &emu_main_context;
+  makecontext(&emu_firmware_context, emu_run, 0);
+  swapcontext(&emu_main_context, &emu_firmware_context);
+  return emu_result;
+}
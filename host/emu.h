@@ -0,0 +1,69 @@
+#pragma once
+
+//host model of SPIM2, GPIOTE, PPI and TIMER3 driving an ST7789, enough to run display.cpp and
+//fast_spi.cpp unchanged. The panel decodes the byte stream with the level of LCD_RS, which is either
+//the GPIO or a GPIOTE task pin, into its 240x320 memory and shows 240x240 of it.
+//The firmware keeps DMA and PPI addresses in 32 bits, so programs are linked without PIE and
+//host_main() runs on a stack in .bss, which keeps every buffer below 4 GB
+#include <stdint.h>
+#include <stdio.h>
+
+#define EMU_WIDTH 240
+#define EMU_HEIGHT 240
+#define EMU_GRAM_ROWS 320
+#define EMU_SPI_MHZ 8
+
+#define EMU_BUS_IMMEDIATE 0//a transfer is done when TASKS_START returns, interrupts run inside it
+#define EMU_BUS_MANUAL 1//transfers wait for emu_spim_finish()
+#define EMU_BUS_ASYNC 2//transfers finish from a timer signal while the program runs on
+
+struct emu_stats_struct {
+  uint32_t bytes;//clocked out with CS low
+  uint32_t cpu_starts;//TASKS_START written by the CPU
+  uint32_t parts;//EasyDMA transfers, including the ones PPI started
+  uint32_t commands;//command bytes other than NOP
+  uint32_t nops;
+  uint32_t windows;//RAMWR
+  uint32_t gpio_writes;
+  uint32_t dc_toggles;//LCD_RS changes done by GPIOTE
+  uint32_t interrupts;
+};
+
+struct emu_trace_struct {
+  uint8_t data;
+  uint8_t dc;
+};
+
+int host_main(int argc, char **argv);
+
+void emu_reset();
+void emu_reset_stats();
+emu_stats_struct emu_get_stats();
+uint32_t emu_bus_us(const emu_stats_struct *stats);
+
+void emu_set_bus(uint32_t mode);
+bool emu_spim_pending(uint32_t *ptr, uint32_t *length);
+void emu_spim_finish();
+bool emu_irq_enabled(int irq);
+
+void emu_screen(uint16_t *pixels);//what the panel shows, with the scroll area, partial and idle mode applied
+const uint16_t *emu_gram();
+bool emu_write_png(const char *file);
+void emu_trace(emu_trace_struct *buffer, uint32_t size);
+uint32_t emu_trace_length();
+void emu_on_scroll(void (*hook)());//called after every VSCSAD
+uint32_t emu_scroll_start();
+
+uint32_t emu_errors();
+const char *emu_first_error();
+
+//the checks of the tests, header only so the BLE tests that do not link emu.o use them as well.
+//Every failed check is counted, the first CHECK_PRINTED of them are printed
+#define CHECK_PRINTED 10
+
+inline uint32_t check_failures;
+
+inline void check(bool ok, const char *what, uint32_t value = 0) {
+  if (ok)return;
+  if (check_failures++ < CHECK_PRINTED)printf("failed: %s (%u)\n", what, value);
+}
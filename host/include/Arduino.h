@@ -0,0 +1,134 @@
+#pragma once
+
+//host stand-in for the parts of the nRF5 Arduino core the firmware uses, good enough to link
+//the display, menu and BLE modules on Linux. Registers come from nrf.h, see emu.h for the models
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+
+#define PROGMEM
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class String {
+  public:
+    String() {}
+    String(const char *text) : s(text ? text : "") {}
+    String(const std::string &text) : s(text) {}
+    String(char c) : s(1, c) {}
+    String(unsigned char v) : s(std::to_string(v)) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    String(float v, int decimals = 2) {
+      char b[32];
+      snprintf(b, sizeof(b), "%.*f", decimals, v);
+      s = b;
+    }
+    String(double v, int decimals = 2) {
+      char b[32];
+      snprintf(b, sizeof(b), "%.*f", decimals, v);
+      s = b;
+    }
+    unsigned int length() const {
+      return s.size();
+    }
+    const char *c_str() const {
+      return s.c_str();
+    }
+    char operator[](unsigned int i) const {
+      return i < s.size() ? s[i] : 0;
+    }
+    char &operator[](unsigned int i) {
+      static char dummy;
+      return i < s.size() ? s[i] : dummy;
+    }
+    char charAt(unsigned int i) const {
+      return (*this)[i];
+    }
+    String substring(unsigned int from) const {
+      return from < s.size() ? String(s.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+      if (to > s.size())to = s.size();
+      return from < to ? String(s.substr(from, to - from)) : String();
+    }
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t p = s.find(c, from);
+      return p == std::string::npos ? -1 : (int)p;
+    }
+    int indexOf(const String &text, unsigned int from = 0) const {
+      size_t p = s.find(text.s, from);
+      return p == std::string::npos ? -1 : (int)p;
+    }
+    bool startsWith(const String &prefix) const {
+      return s.compare(0, prefix.s.size(), prefix.s) == 0;
+    }
+    bool endsWith(const String &suffix) const {
+      return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+    }
+    long toInt() const {
+      return atol(s.c_str());
+    }
+    bool reserve(unsigned int size) {
+      s.reserve(size);
+      return true;
+    }
+    void toCharArray(char *buffer, unsigned int size) const {
+      if (!size)return;
+      strncpy(buffer, s.c_str(), size);
+      buffer[size - 1] = 0;
+    }
+    bool operator==(const String &other) const {
+      return s == other.s;
+    }
+    bool operator==(const char *other) const {
+      return s == other;
+    }
+    bool operator!=(const String &other) const {
+      return s != other.s;
+    }
+    String &operator+=(const String &other) {
+      s += other.s;
+      return *this;
+    }
+    String &operator+=(const char *other) {
+      s += other;
+      return *this;
+    }
+    String &operator+=(char other) {
+      s += other;
+      return *this;
+    }
+    friend String operator+(const String &a, const String &b) {
+      return String(a.s + b.s);
+    }
+    friend String operator+(const String &a, const char *b) {
+      return String(a.s + b);
+    }
+    friend String operator+(const char *a, const String &b) {
+      return String(std::string(a) + b.s);
+    }
+    std::string s;
+};
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(uint32_t pin, uint32_t mode);
+void digitalWrite(uint32_t pin, uint32_t value);
+int digitalRead(uint32_t pin);
+
+#include "nrf.h"
@@ -0,0 +1,99 @@
+#pragma once
+
+//stand-in for arduino-BLEPeripheral with a model of the stack in ble_sim.cpp: a notification takes one of
+//a few stack buffers, poll() is a connection event that frees some of them and hands over what the central
+//wrote. Nothing connects unless a program calls ble_sim_connect(), so the watch programs see an idle radio
+#include <stdint.h>
+#include <string.h>
+
+#define BLE_SIM_PACKET 20
+#define BLE_SIM_AIR 32768//bytes of notifications kept for the programs to check
+#define BLE_SIM_WRITES 512
+
+class BLECentral {};
+class BLECharacteristic;
+
+enum BLEEvent {
+  BLEWritten,
+  BLEConnected,
+  BLEDisconnected
+};
+
+enum BLEProperty {
+  BLENotify = 0x10,
+  BLEWriteWithoutResponse = 0x04
+};
+
+typedef void (*BLECharacteristicEventHandler)(BLECentral &central, BLECharacteristic &characteristic);
+typedef void (*BLEPeripheralEventHandler)(BLECentral &central);
+
+struct ble_sim_struct {
+  bool connected;
+  uint32_t free_buffers;//notifications the stack still takes
+  uint32_t max_buffers;
+  uint32_t done_per_poll;//notifications sent per connection event
+  uint32_t writes_per_poll;//writes of the central handed over per connection event
+  uint32_t polls;
+  uint32_t notifications;
+  uint32_t rejected;//setValue() without a free buffer, the data is lost
+  uint8_t air[BLE_SIM_AIR];//every notification in order
+  uint32_t air_length;
+  uint8_t writes[BLE_SIM_WRITES][BLE_SIM_PACKET];
+  uint8_t write_lengths[BLE_SIM_WRITES];
+  uint32_t write_head, write_tail;
+  BLECharacteristic *rx;
+  BLECharacteristicEventHandler rx_handler;
+  BLEPeripheralEventHandler on_connect, on_disconnect;
+};
+
+extern ble_sim_struct ble_sim;
+
+void ble_sim_connect();
+void ble_sim_disconnect();
+void ble_sim_write(const char *text);//cut into writes of 20 bytes that poll() hands over
+void ble_sim_write_data(const uint8_t *data, uint32_t length);
+uint32_t ble_sim_pending_writes();
+
+class BLEService {
+  public:
+    BLEService(const char *uuid) : _uuid(uuid) {}
+    const char *uuid() const {
+      return _uuid;
+    }
+  private:
+    const char *_uuid;
+};
+
+class BLECharacteristic {
+  public:
+    BLECharacteristic(const char *uuid, unsigned char properties, unsigned char valueSize) : _properties(properties) {}
+    void setEventHandler(BLEEvent event, BLECharacteristicEventHandler handler);
+    bool setValue(const unsigned char *value, unsigned char length);
+    bool setValue(const char *value) {
+      return setValue((const unsigned char *)value, strlen(value));
+    }
+    const unsigned char *value() const {
+      return _value;
+    }
+    unsigned char valueLength() const {
+      return _length;
+    }
+    bool canNotify();
+  private:
+    unsigned char _properties;
+    unsigned char _value[BLE_SIM_PACKET];
+    unsigned char _length = 0;
+};
+
+class BLEPeripheral {
+  public:
+    void setLocalName(const char *name) {}
+    void setAdvertisingInterval(unsigned short interval) {}
+    void setDeviceName(const char *name) {}
+    void setAdvertisedServiceUuid(const char *uuid) {}
+    void addAttribute(BLEService &service) {}
+    void addAttribute(BLECharacteristic &characteristic) {}
+    void setEventHandler(BLEEvent event, BLEPeripheralEventHandler handler);
+    void begin() {}
+    void poll();
+};
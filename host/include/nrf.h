@@ -0,0 +1,157 @@
+#pragma once
+
+//the nRF52 peripherals used by fast_spi.cpp, modelled by emu.cpp. Plain fields behave like memory,
+//writes to tasks, INTENSET/INTENCLR, CHENSET/CHENCLR and GPIOTE CONFIG go through emu_register_write()
+//so the model can act on them. The firmware stores register addresses as uint32_t, so everything
+//the DMA or PPI points at has to live below 4 GB, see emu.h
+#include <stdint.h>
+
+void emu_register_write(volatile void *reg, uint32_t value);
+
+struct nrf_hooked_register {
+  uint32_t value;
+  nrf_hooked_register &operator=(uint32_t v) {
+    emu_register_write(this, v);
+    return *this;
+  }
+  operator uint32_t() const {
+    return value;
+  }
+};
+
+struct NRF_SPIM_Type {
+  nrf_hooked_register TASKS_START;
+  nrf_hooked_register TASKS_STOP;
+  volatile uint32_t EVENTS_STOPPED;
+  volatile uint32_t EVENTS_ENDRX;
+  volatile uint32_t EVENTS_END;
+  volatile uint32_t EVENTS_ENDTX;
+  volatile uint32_t EVENTS_STARTED;
+  uint32_t SHORTS;
+  nrf_hooked_register INTENSET;
+  nrf_hooked_register INTENCLR;
+  uint32_t ENABLE;
+  uint32_t PSELSCK;
+  uint32_t PSELMOSI;
+  uint32_t PSELMISO;
+  struct {
+    uint32_t SCK;
+    uint32_t MOSI;
+    uint32_t MISO;
+  } PSEL;
+  uint32_t FREQUENCY;
+  struct {
+    uint32_t PTR;
+    uint32_t MAXCNT;
+    uint32_t AMOUNT;
+    uint32_t LIST;
+  } RXD, TXD;
+  uint32_t CONFIG;
+  uint32_t ORC;
+};
+
+struct NRF_GPIOTE_Type {
+  nrf_hooked_register TASKS_OUT[8];
+  nrf_hooked_register TASKS_SET[8];
+  nrf_hooked_register TASKS_CLR[8];
+  volatile uint32_t EVENTS_IN[8];
+  volatile uint32_t EVENTS_PORT;
+  uint32_t INTENSET;
+  uint32_t INTENCLR;
+  nrf_hooked_register CONFIG[8];
+  nrf_hooked_register RESERVED[8];//catches CONFIG writes past channel 7
+};
+
+struct NRF_PPI_Type {
+  struct {
+    nrf_hooked_register EN;
+    nrf_hooked_register DIS;
+  } TASKS_CHG[6];
+  uint32_t CHEN;
+  nrf_hooked_register CHENSET;
+  nrf_hooked_register CHENCLR;
+  struct {
+    uint32_t EEP;
+    uint32_t TEP;
+  } CH[20];
+  uint32_t CHG[6];
+  struct {
+    uint32_t TEP;
+  } FORK[32];
+};
+
+struct NRF_TIMER_Type {
+  nrf_hooked_register TASKS_START;
+  nrf_hooked_register TASKS_STOP;
+  nrf_hooked_register TASKS_COUNT;
+  nrf_hooked_register TASKS_CLEAR;
+  nrf_hooked_register TASKS_SHUTDOWN;
+  nrf_hooked_register TASKS_CAPTURE[6];
+  volatile uint32_t EVENTS_COMPARE[6];
+  uint32_t SHORTS;
+  nrf_hooked_register INTENSET;
+  nrf_hooked_register INTENCLR;
+  uint32_t MODE;
+  uint32_t BITMODE;
+  uint32_t PRESCALER;
+  uint32_t CC[6];
+};
+
+struct NRF_POWER_Type {
+  uint32_t RESETREAS;
+  uint32_t GPREGRET;
+};
+
+struct NRF_FICR_Type {
+  uint32_t DEVICEADDR[2];
+};
+
+extern NRF_SPIM_Type *NRF_SPIM2;
+extern NRF_GPIOTE_Type *NRF_GPIOTE;
+extern NRF_PPI_Type *NRF_PPI;
+extern NRF_TIMER_Type *NRF_TIMER1;
+extern NRF_TIMER_Type *NRF_TIMER2;
+extern NRF_TIMER_Type *NRF_TIMER3;
+extern NRF_POWER_Type *NRF_POWER;
+extern NRF_FICR_Type *NRF_FICR;
+
+#define SPIM2_SPIS2_SPI2_IRQn 35
+#define TIMER3_IRQn 26
+#define GPIOTE_IRQn 6
+
+#define SPIM_INTENSET_END_Msk (1UL << 6)
+#define SPIM_INTENCLR_END_Msk (1UL << 6)
+#define SPIM_SHORTS_END_START_Msk (1UL << 17)
+#define SPIM_TXD_LIST_LIST_Pos 0
+#define SPIM_TXD_LIST_LIST_Disabled 0
+#define SPIM_TXD_LIST_LIST_ArrayList 1
+
+#define GPIOTE_CONFIG_MODE_Pos 0
+#define GPIOTE_CONFIG_MODE_Disabled 0
+#define GPIOTE_CONFIG_MODE_Event 1
+#define GPIOTE_CONFIG_MODE_Task 3
+#define GPIOTE_CONFIG_PSEL_Pos 8
+#define GPIOTE_CONFIG_POLARITY_Pos 16
+#define GPIOTE_CONFIG_POLARITY_LoToHi 1
+#define GPIOTE_CONFIG_POLARITY_HiToLo 2
+#define GPIOTE_CONFIG_POLARITY_Toggle 3
+#define GPIOTE_CONFIG_OUTINIT_Pos 20
+#define GPIOTE_CONFIG_OUTINIT_Low 0
+#define GPIOTE_CONFIG_OUTINIT_High 1
+#define GPIOTE_INTENSET_PORT_Msk (1UL << 31)
+
+#define TIMER_MODE_MODE_Timer 0
+#define TIMER_MODE_MODE_Counter 2
+#define TIMER_BITMODE_BITMODE_16Bit 0
+#define TIMER_BITMODE_BITMODE_32Bit 3
+#define TIMER_SHORTS_COMPARE0_CLEAR_Msk (1UL << 0)
+#define TIMER_SHORTS_COMPARE0_STOP_Msk (1UL << 8)
+#define TIMER_INTENSET_COMPARE0_Msk (1UL << 16)
+#define TIMER_INTENSET_COMPARE1_Msk (1UL << 17)
+
+void NVIC_SetPriority(int irq, uint32_t priority);
+void NVIC_EnableIRQ(int irq);
+void NVIC_DisableIRQ(int irq);
+void NVIC_ClearPendingIRQ(int irq);
+void NVIC_SystemReset();
+uint32_t sd_app_evt_wait();
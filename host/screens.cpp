@@ -0,0 +1,64 @@
+#include "emu.h"
+#include "board.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "menu.h"
+#include "push.h"
+
+//draws the menu screens the way the main loop does, writes every frame to <name>.png and prints
+//what it cost on the bus. The first frame of a screen runs pre() and main(), later ones only main()
+
+void screens_frame(const char *name, bool png) {
+  emu_reset_stats();
+  display_screen(true);
+  emu_stats_struct stats = emu_get_stats();
+  printf("%-14s %8u %9u %6u %8u %8u\n", name, stats.bytes, stats.cpu_starts, stats.parts, stats.windows, emu_bus_us(&stats));
+  if (png) {
+    char file[64];
+    snprintf(file, sizeof(file), "%s.png", name);
+    emu_write_png(file);
+  }
+}
+
+int host_main(int argc, char **argv) {
+  init_fast_spi();
+  init_display();
+  printf("%-14s %8s %9s %6s %8s %8s\n", "frame", "bytes", "transfers", "parts", "windows", "bus us");
+
+  emu_reset_stats();
+  display_booting();
+  emu_stats_struct stats = emu_get_stats();
+  printf("%-14s %8u %9u %6u %8u %8u\n", "boot", stats.bytes, stats.cpu_starts, stats.parts, stats.windows, emu_bus_us(&stats));
+  emu_write_png("boot.png");
+
+  display_home();
+  screens_frame("home", true);
+  board.timestamp += 60;
+  board.accl.steps += 12;
+  screens_frame("home_minute", true);
+  screens_frame("home_same", false);
+  for (int page = 1; page <= 3; page++) {//the app pages scroll in from below
+    char name[16];
+    snprintf(name, sizeof(name), "apps%i", page);
+    inc_vars_menu();
+    screens_frame(name, true);
+  }
+  inc_vars_menu();
+  screens_frame("home_again", true);
+
+  show_push("push,Meeting moved to 3pm in room 2.14 and the agenda is in the invite,5,1");
+  screens_frame("notify", true);
+
+  display_always_on();
+  screens_frame("always_on", true);
+  board.timestamp += 60;
+  screens_frame("always_on_min", true);
+
+  if (emu_errors()) {
+    printf("emulator errors: %u, first: %s\n", emu_errors(), emu_first_error());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,176 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "ble_rx.h"
+#include "ble_frame.h"
+
+//ble_rx against a reference parser of the whole stream: random AT commands, commands over the limit, \r, \n, 0
+//and BLE_FRAME_MAGIC inside them and binary frames are cut into writes of 1 to 20 bytes like the stack hands
+//them over. Then a ring that fills up because nothing is taken out. Links only ble_rx and ble_frame so it
+//runs under ASan and UBSan, see the Makefile
+//usage: test_ble_rx [streams]
+
+#define RX_STREAM_SIZE 16384
+#define RX_MAX_COMMANDS 256
+
+struct rx_command_struct {
+  uint32_t start;
+  uint32_t length;
+  bool binary;
+};
+
+uint32_t rx_seed = 1;
+uint8_t rx_stream[RX_STREAM_SIZE];
+rx_command_struct rx_expected[RX_MAX_COMMANDS];
+
+uint32_t rx_random() {
+  rx_seed = rx_seed * 1103515245 + 12345;
+  return rx_seed >> 8;
+}
+
+//commands end at \r\n, longer ones are dropped, a command starting with the magic byte is a frame of its length
+uint32_t rx_reference(const uint8_t *stream, uint32_t len, rx_command_struct *commands, uint32_t *dropped) {
+  uint32_t count = 0;
+  uint32_t pos = 0;
+  while (pos < len) {
+    if (stream[pos] == BLE_FRAME_MAGIC) {
+      if (pos + BLE_FRAME_HEADER > len || pos + BLE_FRAME_OVERHEAD + stream[pos + 3] > len)break;
+      commands[count++] = {pos, (uint32_t)(BLE_FRAME_OVERHEAD + stream[pos + 3]), true};
+      pos += BLE_FRAME_OVERHEAD + stream[pos + 3];
+      continue;
+    }
+    uint32_t end = pos;
+    while (end + 1 < len && !(stream[end] == '\r' && stream[end + 1] == '\n'))end++;
+    if (end + 1 >= len) {//not finished, dropped already once it is over the limit without a last \r
+      if (len - pos - (stream[len - 1] == '\r') > BLE_RX_MAX_COMMAND)(*dropped)++;
+      break;
+    }
+    if (end - pos <= BLE_RX_MAX_COMMAND)commands[count++] = {pos, end - pos, false};
+    else (*dropped)++;
+    pos = end + 2;
+  }
+  return count;
+}
+
+uint32_t rx_text(uint8_t *out) {
+  uint32_t kind = rx_random() % 10;
+  uint32_t len = kind == 0 ? BLE_RX_MAX_COMMAND - 2 + rx_random() % 5 : kind == 1 ? rx_random() % 1500 : rx_random() % 60;
+  for (uint32_t i = 0; i < len; i++) {
+    switch (rx_random() % 20) {
+      case 0:
+        out[i] = '\r';
+        break;
+      case 1:
+        out[i] = '\n';
+        break;
+      case 2:
+        out[i] = 0;
+        break;
+      case 3:
+        out[i] = BLE_FRAME_MAGIC;
+        break;
+      default:
+        out[i] = ' ' + rx_random() % 90;
+        break;
+    }
+  }
+  if (rx_random() % 4) {
+    out[len++] = '\r';
+    out[len++] = '\n';
+  }
+  return len;
+}
+
+uint32_t rx_frame(uint8_t *out) {
+  uint8_t value[BLE_FRAME_MAX_VALUE];
+  uint32_t len = rx_random() % 4 ? rx_random() % 30 : BLE_FRAME_MAX_VALUE;
+  for (uint32_t i = 0; i < len; i++) {
+    uint32_t r = rx_random() % 6;
+    value[i] = r == 0 ? '\r' : r == 1 ? '\n' : r == 2 ? BLE_FRAME_MAGIC : rx_random();
+  }
+  return ble_frame_build(out, rx_random(), rx_random(), value, len);
+}
+
+void test_streams(uint32_t streams) {
+  uint32_t commands = 0, frames = 0;
+  for (uint32_t n = 0; n < streams; n++) {
+    uint32_t len = 0;
+    uint32_t items = rx_random() % 40;
+    for (uint32_t k = 0; k < items && len + 2000 < RX_STREAM_SIZE; k++)
+      len += rx_random() % 3 ? rx_text(&rx_stream[len]) : rx_frame(&rx_stream[len]);
+    uint32_t droppedBefore = get_ble_rx_stats().dropped;
+    uint32_t expectedDropped = 0;
+    uint32_t expected = rx_reference(rx_stream, len, rx_expected, &expectedDropped);
+    uint32_t got = 0;
+    ble_rx_reset();
+    for (uint32_t pos = 0; pos < len;) {
+      uint32_t write = 1 + rx_random() % 20;
+      if (write > len - pos)write = len - pos;
+      ble_rx_push(&rx_stream[pos], write);
+      pos += write;
+      ble_command_struct command;
+      while (ble_rx_next(&command)) {
+        if (got >= expected) {
+          check(false, "more commands than in the stream", n);
+          got++;
+          continue;
+        }
+        const rx_command_struct *e = &rx_expected[got++];
+        check(command.binary == e->binary && command.length == e->length, "command length and kind", n);
+        if (command.length != e->length)continue;
+        check(!memcmp(command.text, &rx_stream[e->start], e->length), "command bytes", n);
+        //text that starts with the magic byte is taken for a frame too, only the built ones pass the CRC
+        if (command.binary)frames += ble_frame_check((const uint8_t *)command.text, command.length);
+        else check(command.text[command.length] == 0, "text terminated", n);
+      }
+    }
+    check(got == expected, "every command of the stream", n);
+    check(get_ble_rx_stats().dropped - droppedBefore == expectedDropped, "commands over the limit dropped", n);
+    commands += got;
+  }
+  printf("%u streams, %u commands, %u of them frames with a good CRC\n", streams, commands, frames);
+}
+
+void rx_push_text(const char *text) {
+  ble_rx_push((const uint8_t *)text, strlen(text));
+}
+
+void test_full_ring() {
+  char text[16];
+  ble_command_struct command;
+  ble_rx_reset();
+  uint32_t droppedBefore = get_ble_rx_stats().dropped;
+  //10 bytes each, 102 fit into the ring, the rest is dropped while nothing is taken out
+  for (uint32_t i = 0; i < 200; i++) {
+    snprintf(text, sizeof(text), "AT+N=%03u\r\n", i);
+    rx_push_text(text);
+  }
+  check(get_ble_rx_stats().dropped - droppedBefore == 200 - BLE_RX_BUFFER_SIZE / 10, "commands without room dropped", get_ble_rx_stats().dropped - droppedBefore);
+  uint32_t i = 0;
+  for (; ble_rx_next(&command); i++) {
+    snprintf(text, sizeof(text), "AT+N=%03u", i);
+    check(!command.binary && !strcmp(command.text, text), "the commands that fit come out in order", i);
+  }
+  check(i == BLE_RX_BUFFER_SIZE / 10, "commands that fit", i);
+  rx_push_text("AT+AFTER\r\n");
+  check(ble_rx_next(&command) && !strcmp(command.text, "AT+AFTER"), "a command after the ring was drained", 0);
+
+  //a frame without room is skipped to its end, an AT command inside its value does not show up
+  uint8_t frame[64];
+  const char *value = "xx\r\nAT+BAD\r\nxxxxxxxxxxxxxxxxxxxxxx";
+  uint32_t frameLen = ble_frame_build(frame, 1, FRAME_STATUS, (const uint8_t *)value, strlen(value));
+  for (i = 0; i < BLE_RX_BUFFER_SIZE / 10 - 1; i++)rx_push_text("AT+FILL=\r\n");//leaves room for the frame header
+  ble_rx_push(frame, frameLen);
+  while (ble_rx_next(&command))check(!strcmp(command.text, "AT+FILL="), "only the fill commands", 0);
+  rx_push_text("AT+OK\r\n");
+  check(ble_rx_next(&command) && !strcmp(command.text, "AT+OK"), "the command after a skipped frame", 0);
+  check(!ble_rx_next(&command), "nothing of the skipped frame", 0);
+}
+
+int main(int argc, char **argv) {
+  uint32_t streams = argc > 1 ? atoi(argv[1]) : 20000;
+  test_streams(streams);
+  test_full_ring();
+  printf("%u failures\n", check_failures);
+  return check_failures != 0;
+}
@@ -0,0 +1,232 @@
+#include "emu.h"
+#include "board.h"
+
+#include "Arduino.h"
+#include "ble.h"
+#include "ble_frame.h"
+#include "history.h"
+
+//the history sync against a phone stand-in on the stack model in ble_sim.cpp. The phone sees notifications a few
+//connection events late, acks every few records and takes a record only at the index it waits for. Every record it
+//takes is compared with the one added for that index, so resent, skipped or garbled records show up as failures
+
+#define SYNC_INTERVAL 30//ms per connection event
+#define SYNC_LAG 4//connection events until the phone sees a notification
+#define SYNC_EVENTS 2000
+#define SYNC_NO_GAP 0xFFFFFFFF
+
+struct central_struct {
+  uint32_t visible[SYNC_LAG];//air length of the last events
+  uint32_t events;
+  uint32_t parsed;
+  bool started;
+  uint32_t start, end;//from the answer to FRAME_SYNC
+  uint32_t next;//index of the record the phone waits for
+  uint32_t lastAck;
+  uint32_t ackEvery;
+  uint32_t gap;//index of the first frame after a missed one
+  bool dupAcked;
+  uint32_t loseFrame;//number of the data frame the phone misses, 0 for none
+  uint32_t loseAcksUntil;//ms until every ack of the phone is lost
+  uint32_t frames, records, duplicates, skipped, skipTo, acks, lostAcks;
+};
+
+central_struct central;
+
+history_record_struct sync_record(uint32_t index) {
+  return {1760000000 + index * 900, index * 37, (uint8_t)(60 + index % 40), (uint8_t)(100 - index % 100)};
+}
+
+void sync_add(uint32_t count) {
+  for (uint32_t i = 0; i < count; i++)add_history_record(sync_record(get_history_end()));
+}
+
+uint32_t sync_get32(const uint8_t *data) {
+  return data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+void central_write(uint8_t type, const uint8_t *value, uint32_t length) {
+  uint8_t frame[BLE_FRAME_OVERHEAD + 8];
+  ble_sim_write_data(frame, ble_frame_build(frame, 0, type, value, length));
+}
+
+void central_ack() {
+  central.lastAck = central.next;
+  if (board.ms < central.loseAcksUntil) {
+    central.lostAcks++;
+    return;
+  }
+  uint8_t value[4] = {(uint8_t)central.next, (uint8_t)(central.next >> 8), (uint8_t)(central.next >> 16), (uint8_t)(central.next >> 24)};
+  central_write(FRAME_SYNC_ACK, value, 4);
+  central.acks++;
+}
+
+void central_data(const uint8_t *value, uint32_t length) {
+  check(length > 4 && (length - 4) % HISTORY_RECORD_SIZE == 0, "data frames carry whole records", length);
+  if (length <= 4)return;
+  if (++central.frames == central.loseFrame)return;
+  uint32_t index = sync_get32(value);
+  uint32_t count = (length - 4) / HISTORY_RECORD_SIZE;
+  if (index > central.next) {
+    if (index != central.gap) {
+      if (central.gap == SYNC_NO_GAP) {//the same ack twice, the watch goes back to it
+        central.gap = index;
+        if (central.lastAck != central.next)central_ack();
+        central_ack();
+      }
+      return;
+    }
+    //sent again from the same index, everything before it is overwritten on the watch
+    central.skipped += index - central.next;
+    central.skipTo = index;
+    central.next = index;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t r = index + i;
+    if (r < central.next) {
+      central.duplicates++;
+      if (!central.dupAcked)central_ack();//the watch has not seen the last ack
+      central.dupAcked = true;
+      continue;
+    }
+    uint8_t expected[HISTORY_RECORD_SIZE];
+    put_history_record(expected, sync_record(r));
+    check(!memcmp(&value[4 + i * HISTORY_RECORD_SIZE], expected, HISTORY_RECORD_SIZE), "record matches its index", r);
+    check(r < central.end, "no record past the end", r);
+    central.next = r + 1;
+    central.records++;
+    central.gap = SYNC_NO_GAP;
+    central.dupAcked = false;
+  }
+  if (central.next - central.lastAck >= central.ackEvery || central.next >= central.end)central_ack();
+}
+
+//one connection event on the phone, it parses what was sent SYNC_LAG events ago
+void central_event() {
+  uint32_t visible = central.visible[central.events % SYNC_LAG];
+  central.visible[central.events % SYNC_LAG] = ble_sim.air_length;
+  central.events++;
+  while (central.parsed + BLE_FRAME_OVERHEAD <= visible) {
+    const uint8_t *frame = &ble_sim.air[central.parsed];
+    uint32_t length = BLE_FRAME_OVERHEAD + frame[3];
+    if (central.parsed + length > visible)break;
+    check(frame[0] == BLE_FRAME_MAGIC && ble_frame_check(frame, length), "whole frames with a good CRC", central.parsed);
+    central.parsed += length;
+    if (frame[2] == (FRAME_SYNC | BLE_FRAME_REPLY) && frame[3] == 8) {
+      central.started = true;
+      central.start = sync_get32(&frame[BLE_FRAME_HEADER]);
+      central.end = sync_get32(&frame[BLE_FRAME_HEADER + 4]);
+      central.next = central.start;
+      central.lastAck = central.start;
+    } else if (frame[2] == FRAME_SYNC_DATA) {
+      check(central.started, "no data before the answer");
+      central_data(&frame[BLE_FRAME_HEADER], frame[3]);
+    }
+  }
+}
+
+void sync_fresh(uint32_t ackEvery) {
+  ble_sim_disconnect();
+  ble_sim.air_length = 0;
+  ble_sim_connect();
+  memset(&central, 0, sizeof(central));
+  central.gap = SYNC_NO_GAP;
+  central.ackEvery = ackEvery;
+}
+
+void sync_start(uint32_t from, uint8_t window) {
+  uint8_t request[5] = {(uint8_t)from, (uint8_t)(from >> 8), (uint8_t)(from >> 16), (uint8_t)(from >> 24), window};
+  central_write(FRAME_SYNC, request, window ? 5 : 4);
+}
+
+//connection events until the phone has everything up to the end
+uint32_t sync_events(uint32_t maxEvents) {
+  for (uint32_t i = 0; i < maxEvents; i++) {
+    board.ms += SYNC_INTERVAL;
+    ble_feed();
+    central_event();
+    if (central.started && central.next >= central.end)return i + 1;
+  }
+  return maxEvents;
+}
+
+void sync_check_complete(const char *what) {
+  check(central.started && central.next == central.end, what, central.next);
+  check(central.records + central.skipped == central.end - central.start, "every record taken or skipped once", central.records);
+}
+
+uint32_t test_clean() {
+  uint32_t events24 = 0;
+  static const uint8_t windows[] = {3, 6, 12, 24};
+  for (uint32_t i = 0; i < sizeof(windows); i++) {
+    sync_fresh(windows[i] / BLE_SYNC_FRAME_NOTIFICATIONS * BLE_SYNC_FRAME_RECORDS / 2);//ack at half the window
+    sync_start(get_history_first(), windows[i]);
+    uint32_t events = sync_events(SYNC_EVENTS);
+    sync_check_complete("a clean sync completes");
+    check(!central.duplicates && !central.skipped, "nothing sent twice or skipped", central.duplicates);
+    printf("window %2u notifications: %u records in %u events, %.0f records/s\n", windows[i], central.records, events, central.records * 1000.0 / (events * SYNC_INTERVAL));
+    events24 = events;
+  }
+  return events24;
+}
+
+void test_past_end() {
+  sync_fresh(20);
+  sync_start(get_history_end() + 5, 24);
+  sync_events(20);
+  check(central.started && central.start == central.end && central.end == get_history_end(), "a start past the end is answered with the end", central.start);
+  check(!central.frames, "nothing sent past the end", central.frames);
+}
+
+void test_lost_frame(uint32_t cleanEvents) {
+  //the phone misses a data frame, two acks for the same index bring the watch back to it
+  sync_fresh(20);
+  central.loseFrame = 3;
+  sync_start(get_history_first(), 24);
+  uint32_t events = sync_events(SYNC_EVENTS);
+  sync_check_complete("a sync with a lost frame completes");
+  check(!central.skipped, "nothing skipped after a lost frame", central.skipped);
+  check(events < cleanEvents + BLE_SYNC_TIMEOUT / SYNC_INTERVAL, "go back without waiting for the timeout", events);
+  printf("lost frame: %u events against %u, %u acks\n", events, cleanEvents, central.acks);
+}
+
+void test_lost_acks() {
+  //every ack for 600 ms is lost, the watch stops at the window and sends it all again after the timeout
+  sync_fresh(20);
+  central.loseAcksUntil = board.ms + 600;
+  sync_start(get_history_first(), 24);
+  uint32_t events = sync_events(SYNC_EVENTS);
+  sync_check_complete("a sync with lost acks completes");
+  check(central.lostAcks > 0, "acks were lost", central.lostAcks);
+  check(central.duplicates > 0, "the unacknowledged records are sent again", central.duplicates);
+  check(!central.skipped, "nothing skipped after lost acks", central.skipped);
+  check(events * SYNC_INTERVAL > BLE_SYNC_TIMEOUT, "waited for the timeout", events);
+  printf("lost acks: %u events, %u records sent twice\n", events, central.duplicates);
+}
+
+void test_overwrite() {
+  //100 records are added while the phone is at the start, the watch goes on at get_history_first()
+  sync_fresh(20);
+  sync_start(get_history_first(), 24);
+  sync_events(10);
+  check(central.started && central.next < 100 + get_history_first(), "the sync is behind the records added next", central.next);
+  sync_add(100);
+  uint32_t first = get_history_first();
+  uint32_t events = sync_events(SYNC_EVENTS);
+  sync_check_complete("a sync over overwritten records completes");
+  check(central.skipped > 0 && central.skipTo == first, "the overwritten records are skipped up to the first one", central.skipTo);
+  printf("overwritten: %u records, %u skipped to %u in %u more events\n", central.records, central.skipped, central.skipTo, events);
+}
+
+int host_main(int argc, char **argv) {
+  init_ble();
+  ble_sim_connect();
+  sync_add(HISTORY_RECORDS);
+  uint32_t cleanEvents = test_clean();
+  test_past_end();
+  test_lost_frame(cleanEvents);
+  test_lost_acks();
+  test_overwrite();
+  printf("%u failures\n", check_failures);
+  return check_failures != 0;
+}
@@ -0,0 +1,138 @@
+#include "emu.h"
+#include "board.h"
+
+#include "Arduino.h"
+#include "ble.h"
+#include "ble_tx.h"
+
+//answers against the stack model in ble_sim.cpp: a central that writes faster than the stack sends fills the
+//queue, then answers have to be dropped whole and everything that reaches the phone has to be whole and in
+//order. A stack without free buffers gets no setValue() at all, the queue waits and is sent packed later
+
+#define TX_COMMANDS 100
+#define TX_LINE 48
+
+char tx_replies[TX_COMMANDS][TX_LINE];
+uint32_t tx_reply_count;
+
+void tx_start(uint32_t maxBuffers, uint32_t donePerPoll, uint32_t writesPerPoll) {
+  ble_sim.max_buffers = maxBuffers;
+  ble_sim.free_buffers = maxBuffers;
+  ble_sim.done_per_poll = donePerPoll;
+  ble_sim.writes_per_poll = writesPerPoll;
+  ble_sim.air_length = 0;
+  ble_sim.notifications = 0;
+  ble_sim.rejected = 0;
+  tx_reply_count = 0;
+}
+
+//the central asks for an echo, the answer the watch should send is noted
+void tx_command(uint32_t n) {
+  char command[TX_LINE];
+  snprintf(command, sizeof(command), "AT+USER=%03u some data to echo\r\n", n);
+  ble_sim_write(command);
+  snprintf(tx_replies[tx_reply_count++], TX_LINE, "AT+USER:%03u some data to echo", n);
+}
+
+uint32_t tx_queued() {
+  return BLE_TX_BUFFER_SIZE - ble_tx_free();
+}
+
+void tx_run(uint32_t polls) {
+  for (uint32_t i = 0; i < polls && (ble_sim_pending_writes() || tx_queued()); i++)ble_feed();
+}
+
+//returns the lines on the air, every one has to be a whole answer and come after the one before it
+uint32_t tx_air_lines() {
+  uint32_t lines = 0, reply = 0, start = 0;
+  for (uint32_t i = 1; i < ble_sim.air_length; i++) {
+    if (ble_sim.air[i - 1] != '\r' || ble_sim.air[i] != '\n')continue;
+    uint32_t length = i - 1 - start;
+    while (reply < tx_reply_count && (strlen(tx_replies[reply]) != length || memcmp(tx_replies[reply], &ble_sim.air[start], length)))reply++;
+    check(reply < tx_reply_count, "a whole answer in order", lines);
+    reply++;
+    lines++;
+    start = i + 1;
+  }
+  check(start == ble_sim.air_length, "no part of an answer after the last one", ble_sim.air_length - start);
+  return lines;
+}
+
+void test_backpressure() {
+  //the stack takes 3 notifications and sends one per connection event, the central writes 50 times per event
+  tx_start(3, 1, 50);
+  ble_tx_stats_struct before = get_ble_tx_stats();
+  for (uint32_t n = 0; n < TX_COMMANDS; n++)tx_command(n);
+  tx_run(10000);
+  ble_tx_stats_struct after = get_ble_tx_stats();
+  uint32_t queued = after.queued - before.queued;
+  uint32_t dropped = after.dropped - before.dropped;
+  check(!ble_sim_pending_writes() && !tx_queued(), "everything handled and sent");
+  check(ble_sim.rejected == 0, "setValue() only when canNotify()", ble_sim.rejected);
+  check(queued + dropped == TX_COMMANDS, "every answer queued or dropped", queued + dropped);
+  check(dropped > 0, "the burst overflows the queue", dropped);
+  check(after.sent - before.sent == ble_sim.notifications, "sent counts the notifications", ble_sim.notifications);
+  check(tx_air_lines() == queued, "every queued answer reaches the phone", queued);
+  printf("burst of %u: %u answers queued, %u dropped, %u notifications in %u polls\n", TX_COMMANDS, queued, dropped, ble_sim.notifications, ble_sim.polls);
+}
+
+void test_stalled() {
+  //no buffer comes free, the answers wait in the queue
+  tx_start(0, 0, 10);
+  uint32_t bytes = 0;
+  for (uint32_t n = 0; n < 3; n++) {
+    tx_command(n);
+    bytes += strlen(tx_replies[n]) + 2;
+  }
+  for (uint32_t i = 0; i < 20; i++)ble_feed();
+  check(ble_sim.notifications == 0 && ble_sim.rejected == 0, "nothing handed to a full stack", ble_sim.rejected);
+  check(tx_queued() == bytes, "the answers wait in the queue", tx_queued());
+  //the stack catches up, the waiting answers go out as full notifications
+  ble_sim.max_buffers = 7;
+  ble_sim.done_per_poll = 7;
+  tx_run(100);
+  check(tx_air_lines() == 3, "all waiting answers sent");
+  check(ble_sim.notifications == (bytes + BLE_TX_PACKET - 1) / BLE_TX_PACKET, "packed into full notifications", ble_sim.notifications);
+}
+
+void test_disconnect() {
+  tx_start(0, 0, 10);
+  tx_command(0);
+  tx_command(1);
+  tx_run(20);
+  check(tx_queued() > 0, "answers wait for the stack");
+  ble_sim_disconnect();
+  check(!tx_queued(), "a disconnect drops the answers for the old central", tx_queued());
+  ble_sim.max_buffers = 7;
+  ble_sim.done_per_poll = 2;
+  ble_sim_connect();
+  ble_sim.air_length = 0;
+  tx_reply_count = 0;
+  tx_command(2);
+  tx_run(100);
+  check(tx_air_lines() == 1 && !memcmp(ble_sim.air, "AT+USER:002", 11), "only the answer for the new central");
+}
+
+void test_length() {
+  //the handlers take exactly length bytes of the argument, whatever follows in the buffer
+  tx_start(7, 7, 10);
+  filterCmd("AT+CONTRAST=1005", 15);
+  check(board.backlight == 1, "AT+CONTRAST=100 read up to length", board.backlight);
+  filterCmd("AT+USER=12345", 10);
+  tx_run(100);
+  tx_reply_count = 0;
+  snprintf(tx_replies[tx_reply_count++], TX_LINE, "AT+CONTRAST:100");
+  snprintf(tx_replies[tx_reply_count++], TX_LINE, "AT+USER:12");
+  check(tx_air_lines() == 2, "the echoes end at length");
+}
+
+int host_main(int argc, char **argv) {
+  init_ble();
+  ble_sim_connect();
+  test_backpressure();
+  test_stalled();
+  test_disconnect();
+  test_length();
+  printf("%u failures\n", check_failures);
+  return check_failures != 0;
+}
@@ -0,0 +1,147 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "images.h"
+
+//random draw calls are sent once straight to the panel and once inside display frames,
+//after every frame both runs have to show the same pixels
+//usage: test_frames [frames per round] [rounds]
+#define FRAMES_OPS 6
+
+uint32_t frames_seed;
+
+uint32_t frames_random(uint32_t range) {
+  frames_seed = frames_seed * 1103515245 + 12345;
+  return (frames_seed >> 8) % range;
+}
+
+uint16_t frames_color() {
+  static const uint16_t colors[] = {0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFE0};
+  return frames_random(3) ? colors[frames_random(6)] : frames_random(0x10000);
+}
+
+//returns the glyphs in the text
+uint32_t frames_text(char *text) {
+  static const char *pieces[] = {"0", "12", ":", "Hi", "Steps", " ", "\xC3\xA4", "\xC5\xA1", "@", "~"};
+  static const uint8_t glyphs[] = {1, 2, 1, 2, 5, 1, 1, 1, 1, 1};
+  uint32_t count = 1 + frames_random(4);
+  uint32_t total = 0;
+  text[0] = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t piece = frames_random(10);
+    strcat(text, pieces[piece]);
+    total += glyphs[piece];
+  }
+  return total;
+}
+
+void frames_op() {
+  uint32_t x, y;
+  uint16_t color = frames_color();
+  uint16_t bg = frames_color();
+  char text[64];
+  switch (frames_random(8)) {
+    case 0:
+    case 1:
+    case 2:
+      x = frames_random(240);
+      y = frames_random(240);
+      displayRect(x, y, 1 + frames_random(240 - x), 1 + frames_random(240 - y), color);
+      break;
+    case 3:
+    case 4: {
+        uint32_t size = 1 + frames_random(4);
+        uint32_t glyphs = frames_text(text);
+        while (glyphs * 6 * size > 234)size--;//displayPrintln() does not clip a glyph that starts before the edge
+        if (!frames_random(4))bg = color;//transparent
+        displayPrintln(frames_random(235 - glyphs * 6 * size), frames_random(241 - 8 * size), text, color, bg, size);
+        break;
+      }
+    case 5:
+      displayImageIndexed(frames_random(217), frames_random(217), 24, 24, frames_random(2) ? symbolBle1 : symbolHeartSmall);
+      break;
+    case 6:
+      displayImageRLE(frames_random(169), frames_random(169), 72, 72, symbolDebug);
+      break;
+    case 7:
+      displayImage(frames_random(193), frames_random(193), 48, 48, image2);
+      break;
+  }
+}
+
+uint32_t frames_hash() {
+  static uint16_t pixels[EMU_WIDTH * EMU_HEIGHT];
+  emu_screen(pixels);
+  uint32_t hash = 2166136261u;
+  for (uint32_t i = 0; i < EMU_WIDTH * EMU_HEIGHT; i++)hash = (hash ^ pixels[i]) * 16777619u;
+  return hash;
+}
+
+//returns the frames that did not match
+uint32_t frames_round(uint32_t round, uint32_t frames, uint32_t *hashes, emu_stats_struct *immediate, emu_stats_struct *framed) {
+  uint32_t mismatches = 0;
+  display_clear();
+  emu_reset_stats();
+  frames_seed = round;
+  for (uint32_t f = 0; f < frames; f++) {
+    uint32_t ops = 1 + frames_random(FRAMES_OPS);
+    for (uint32_t i = 0; i < ops; i++)frames_op();
+    hashes[f] = frames_hash();
+  }
+  *immediate = emu_get_stats();
+  display_clear();
+  emu_reset_stats();
+  frames_seed = round;
+  for (uint32_t f = 0; f < frames; f++) {
+    uint32_t ops = 1 + frames_random(FRAMES_OPS);
+    begin_display_frame();
+    for (uint32_t i = 0; i < ops; i++)frames_op();
+    end_display_frame();
+    if (frames_hash() != hashes[f]) {
+      if (!mismatches)printf("round %u: frame %u differs\n", round, f);
+      mismatches++;
+    }
+  }
+  *framed = emu_get_stats();
+  return mismatches;
+}
+
+//a clear inside a frame is drawn once when the frame ends, not also right away
+uint32_t frames_clear() {
+  display_clear();
+  displayRect(0, 0, 240, 240, 0xF800);
+  emu_reset_stats();
+  begin_display_frame();
+  display_clear();
+  displayRect(100, 100, 20, 20, 0xFFFF);
+  end_display_frame();
+  uint32_t bytes = emu_get_stats().bytes;
+  static uint16_t pixels[EMU_WIDTH * EMU_HEIGHT];
+  emu_screen(pixels);
+  bool ok = bytes < EMU_WIDTH * EMU_HEIGHT * 2 + 1000 && pixels[0] == 0x0000 && pixels[110 * EMU_WIDTH + 110] == 0xFFFF;
+  printf("clear inside a frame: %u bytes%s\n", bytes, ok ? "" : ", expected one screen");
+  return !ok;
+}
+
+int host_main(int argc, char **argv) {
+  uint32_t frames = argc > 1 ? atoi(argv[1]) : 500;
+  uint32_t rounds = argc > 2 ? atoi(argv[2]) : 16;
+  static uint32_t hashes[100000];
+  if (frames > 100000)frames = 100000;
+  init_fast_spi();
+  init_display();
+  uint32_t failures = frames_clear();
+  uint32_t mismatches = 0;
+  uint64_t immediateBytes = 0, framedBytes = 0;
+  for (uint32_t round = 1; round <= rounds; round++) {
+    emu_stats_struct immediate, framed;
+    mismatches += frames_round(round, frames, hashes, &immediate, &framed);
+    immediateBytes += immediate.bytes;
+    framedBytes += framed.bytes;
+  }
+  printf("%u rounds of %u frames: %u mismatches, %u emulator errors%s%s\n", rounds, frames, mismatches, emu_errors(), emu_errors() ? ", first: " : "", emu_first_error());
+  printf("bytes sent: %llu drawn right away, %llu in frames\n", (unsigned long long)immediateBytes, (unsigned long long)framedBytes);
+  return failures || mismatches || emu_errors();
+}
@@ -0,0 +1,147 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "images.h"
+
+//scrolled screens against the panel's VSCRDEF/VSCSAD: during scroll_display_frame() every VSCSAD has to show
+//the old screen moved out by one more step and the new one coming in, and drawing after any scroll has to
+//look the same as drawing without it
+
+#define SCROLL_STEP 40
+
+uint16_t scroll_old[EMU_WIDTH * EMU_HEIGHT], scroll_new[EMU_WIDTH * EMU_HEIGHT], scroll_shown[EMU_WIDTH * EMU_HEIGHT];
+uint32_t scroll_steps, scroll_bad_steps;
+bool scroll_up;
+
+void scroll_page(int page) {
+  displayRect(0, 0, 240, 240, 0x0000);
+  displayImageIndexed(228, 100 + 14 * page, 12, 12, symbolCheck2);
+  displayImageRLE(32, 28, 72, 71, symbolHeart);
+  displayRect(10 + page * 20, 120, 100, 60, 0xF800 + page * 0x41);
+  displayPrintln(0, 200, "Page " + (String)page + " ABCDEFGHIJ", 0xFFFF, 0x0000, 2);
+  displayPrintln(5, 226, "transparent", 0x07E0, 0x07E0, 1);
+}
+
+void scroll_reference(int page, uint16_t *pixels) {
+  begin_display_frame();
+  scroll_page(page);
+  end_display_frame();
+  emu_screen(pixels);
+}
+
+//runs on every VSCSAD while a screen scrolls in
+void scroll_step() {
+  emu_screen(scroll_shown);
+  uint32_t s = ++scroll_steps * SCROLL_STEP;
+  for (uint32_t y = 0; y < EMU_HEIGHT; y++) {
+    const uint16_t *row;
+    if (scroll_up)row = y < EMU_HEIGHT - s ? &scroll_old[(y + s) * EMU_WIDTH] : &scroll_new[(y + s - EMU_HEIGHT) * EMU_WIDTH];
+    else row = y < s ? &scroll_new[(EMU_HEIGHT - s + y) * EMU_WIDTH] : &scroll_old[(y - s) * EMU_WIDTH];
+    if (memcmp(row, &scroll_shown[y * EMU_WIDTH], EMU_WIDTH * 2)) {
+      scroll_bad_steps++;
+      return;
+    }
+  }
+}
+
+uint32_t scroll_diff(const uint16_t *reference) {
+  emu_screen(scroll_shown);
+  uint32_t diff = 0;
+  for (uint32_t i = 0; i < EMU_WIDTH * EMU_HEIGHT; i++)diff += scroll_shown[i] != reference[i];
+  return diff;
+}
+
+void test_transitions() {
+  scroll_reference(1, scroll_new);
+  scroll_reference(0, scroll_old);
+  for (int round = 0; round < 6; round++) {
+    scroll_up = round % 3 != 2;
+    scroll_steps = 0;
+    scroll_bad_steps = 0;
+    emu_on_scroll(scroll_step);
+    begin_display_frame();
+    scroll_page(round & 1 ? 0 : 1);
+    scroll_display_frame(scroll_up);
+    emu_on_scroll(NULL);
+    check(scroll_steps == EMU_HEIGHT / SCROLL_STEP, "one VSCSAD per step");
+    check(!scroll_bad_steps, "every step shows the old screen moving out and the new one coming in");
+    check(!scroll_diff(scroll_new), "the new screen is shown after the last step");
+    static uint16_t swap[EMU_WIDTH * EMU_HEIGHT];
+    memcpy(swap, scroll_old, sizeof(swap));
+    memcpy(scroll_old, scroll_new, sizeof(swap));
+    memcpy(scroll_new, swap, sizeof(swap));
+  }
+  check(emu_scroll_start() != 0, "the transitions left the memory scrolled");
+}
+
+void scroll_more() {
+  begin_display_frame();
+  displayRect(100, 0, 30, 240, 0x1234);
+  displayPrintln(0, 100, "after", 0xFFFF, 0x001F, 3);
+  end_display_frame();
+  displayRect(0, 150, 240, 90, 0x4321);
+  displayImageIndexed(100, 225, 12, 12, symbolCheck1);
+  displayPrintln(0, 80, "direct", 0x0000, 0xFFFF, 4);
+  drawChar(200, 60, 'X', 0xFFFF, 0xFFFF, 8);
+}
+
+void test_after_scroll() {
+  static uint16_t scrolled[EMU_WIDTH * EMU_HEIGHT];
+  scroll_more();//on the last page of test_transitions(), still scrolled
+  emu_screen(scrolled);
+  set_display_scroll_area(0, DISPLAY_GRAM_ROWS);
+  scroll_page(0);
+  scroll_more();
+  check(!scroll_diff(scrolled), "drawing on a scrolled screen looks like drawing on a plain one");
+}
+
+void notify_lines(int first, int from, int to) {
+  char line[16];
+  for (int i = from; i < to; i++) {
+    snprintf(line, sizeof(line), "line %d", first + i);
+    displayRect(0, 10 + i * 16, 240, 16, 0x0000);
+    displayPrintln(0, 10 + i * 16, line, 0xFFFF, 0x0000, 2);
+  }
+}
+
+void notify_frame() {
+  displayRect(0, 0, 240, 240, 0x0000);
+  displayPrintln(0, 0, "Notification:");
+  displayImageRLE(84, 168, 72, 72, symbolMsg);
+}
+
+void test_notify() {
+  //a scroll area between title and icon like NotifyScreen, only the lines that came in are drawn
+  static uint16_t scrolled[EMU_WIDTH * EMU_HEIGHT];
+  static const int moves[] = {3, 3, 2, -3, 3, -3, -2, 1};
+  set_display_scroll_area(10, 144);
+  notify_frame();
+  notify_lines(0, 0, 9);
+  int first = 0;
+  for (uint32_t m = 0; m < sizeof(moves) / sizeof(moves[0]); m++) {
+    begin_display_frame();
+    scroll_display(moves[m] * 16);
+    first += moves[m];
+    if (moves[m] > 0)notify_lines(first, 9 - moves[m], 9);
+    else notify_lines(first, 0, -moves[m]);
+    end_display_frame();
+  }
+  emu_screen(scrolled);
+  set_display_scroll_area(0, DISPLAY_GRAM_ROWS);
+  notify_frame();
+  notify_lines(first, 0, 9);
+  check(!scroll_diff(scrolled), "scrolled notification lines look like drawing them in place");
+}
+
+int host_main(int argc, char **argv) {
+  init_fast_spi();
+  init_display();
+  test_transitions();
+  test_after_scroll();
+  test_notify();
+  if (emu_errors())printf("emulator errors: %u, first: %s\n", emu_errors(), emu_first_error());
+  printf("%u failures\n", check_failures);
+  return check_failures || emu_errors();
+}
@@ -0,0 +1,135 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "pinout.h"
+#include "images.h"
+
+//write_fast_spi_async() at register level: with a manual bus every EVENTS_END is raised by hand and runs
+//the SPIM2 and TIMER3 handlers, the test checks each part the DMA is handed and when callbacks run.
+//Then the display is drawn with transfers finishing from a timer signal and compared to blocking ones
+
+uint8_t async_buffer[2048];
+char async_log[256];
+
+void async_note(const char *text) {
+  strncat(async_log, text, sizeof(async_log) - strlen(async_log) - 1);
+}
+
+//finishes parts until the bus is idle, writes "<offset>+<length> " for every part
+void async_drain() {
+  uint32_t ptr, length;
+  char part[32];
+  for (int guard = 0; emu_spim_pending(&ptr, &length) && guard < 100; guard++) {
+    snprintf(part, sizeof(part), "%u+%u ", ptr - (uint32_t)(uintptr_t)async_buffer, length);
+    async_note(part);
+    emu_spim_finish();
+  }
+}
+
+void async_first_done() {
+  async_note("A ");
+}
+
+void async_second_done() {
+  async_note("B ");
+}
+
+void async_chained_done() {
+  async_note("A ");
+  write_fast_spi_async(async_buffer + 1000, 20, async_second_done);
+  async_note(get_fast_spi_busy() ? "busy " : "idle ");
+}
+
+void async_start(const char *name) {
+  async_log[0] = 0;
+  emu_reset_stats();
+  digitalWrite(LCD_CS, LOW);
+}
+
+void async_end() {
+  digitalWrite(LCD_CS, HIGH);
+}
+
+void test_parts() {
+  async_start("parts");
+  write_fast_spi_async(async_buffer, 300, async_first_done);
+  check(get_fast_spi_busy(), "busy after the start");
+  async_drain();
+  check(!get_fast_spi_busy(), "idle after the last part");
+  check(!strcmp(async_log, "0+255 255+45 A "), "300 bytes go out as 255 + 45 and then the callback");
+  check(emu_get_stats().cpu_starts == 2 && emu_get_stats().interrupts == 2, "one interrupt per part");
+  async_end();
+}
+
+void test_list() {
+  async_start("list");
+  write_fast_spi_async(async_buffer, 1000, async_first_done);
+  async_drain();
+  check(!strcmp(async_log, "0+255 255+255 510+255 765+235 A "), "1000 bytes go out as a list of three parts and the rest");
+  emu_stats_struct stats = emu_get_stats();
+  check(stats.cpu_starts == 2, "the list is started once, PPI starts the other parts");
+  check(stats.parts == 4 && stats.bytes == 1000, "all bytes are sent once");
+  check(stats.interrupts == 2, "the list only interrupts after its last part");
+  async_end();
+}
+
+void test_chained() {
+  async_start("chained");
+  write_fast_spi_async(async_buffer, 300, async_chained_done);
+  async_drain();
+  check(!strcmp(async_log, "0+255 255+45 A busy 1000+20 B "), "a transfer started from the callback runs after it");
+  check(!get_fast_spi_busy(), "idle after the second callback");
+  async_end();
+}
+
+void test_single_byte() {
+  async_start("single");
+  write_fast_spi_async(async_buffer, 1, async_first_done);
+  check(!strcmp(async_log, "A "), "a single byte is sent blocking and the callback runs before the call returns");
+  check(emu_get_stats().bytes == 1, "the byte went out");
+  async_end();
+}
+
+uint32_t async_hash() {
+  const uint16_t *gram = emu_gram();
+  uint32_t hash = 2166136261u;
+  for (uint32_t i = 0; i < EMU_WIDTH * EMU_GRAM_ROWS; i++)hash = (hash ^ gram[i]) * 16777619u;
+  return hash;
+}
+
+void async_draw() {
+  display_clear();
+  displayRect(10, 20, 200, 150, 0xF800);
+  displayRect(0, 0, 240, 240, 0x07E0);
+  displayImage(96, 96, 48, 48, image2);
+  displayImageRLE(0, 168, 72, 72, symbolDebug);
+  displayImageIndexed(200, 0, 24, 24, symbolBle1);
+  displayPrintln(0, 0, "Async", 0xFFFF, 0x0000, 3);
+  displayRect(30, 30, 1, 1, 0x001F);
+}
+
+int host_main(int argc, char **argv) {
+  for (uint32_t i = 0; i < sizeof(async_buffer); i++)async_buffer[i] = i * 7;
+  init_fast_spi();
+  init_display();
+  emu_set_bus(EMU_BUS_MANUAL);
+  test_parts();
+  test_list();
+  test_chained();
+  emu_set_bus(EMU_BUS_IMMEDIATE);//single bytes wait for EVENTS_END
+  test_single_byte();
+
+  async_draw();
+  uint32_t blocking = async_hash();
+  emu_set_bus(EMU_BUS_ASYNC);
+  async_draw();
+  wait_fast_spi();
+  emu_set_bus(EMU_BUS_IMMEDIATE);
+  check(async_hash() == blocking, "drawing with transfers in the background gives the same memory");
+
+  if (emu_errors())printf("emulator errors: %u, first: %s\n", emu_errors(), emu_first_error());
+  printf("%u failures\n", check_failures);
+  return check_failures || emu_errors();
+}
@@ -0,0 +1,147 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+
+//decodeUtf8() against a strict reference decoder: every code point of Latin-1 and Latin Extended-A,
+//truncated, overlong and broken sequences, and random bytes where the glyphs of a whole buffer must match
+//usage: test_utf8 [random buffers]
+
+uint32_t utf8_seed = 1;
+
+uint32_t utf8_random() {
+  utf8_seed = utf8_seed * 1103515245 + 12345;
+  return utf8_seed >> 8;
+}
+
+uint32_t utf8_encode(uint32_t codePoint, unsigned char *out) {
+  if (codePoint < 0x80) {
+    out[0] = codePoint;
+    return 1;
+  }
+  if (codePoint < 0x800) {
+    out[0] = 0xC0 | codePoint >> 6;
+    out[1] = 0x80 | (codePoint & 0x3F);
+    return 2;
+  }
+  if (codePoint < 0x10000) {
+    out[0] = 0xE0 | codePoint >> 12;
+    out[1] = 0x80 | ((codePoint >> 6) & 0x3F);
+    out[2] = 0x80 | (codePoint & 0x3F);
+    return 3;
+  }
+  out[0] = 0xF0 | codePoint >> 18;
+  out[1] = 0x80 | ((codePoint >> 12) & 0x3F);
+  out[2] = 0x80 | ((codePoint >> 6) & 0x3F);
+  out[3] = 0x80 | (codePoint & 0x3F);
+  return 4;
+}
+
+//RFC 3629 without the surrogate and U+10FFFF limits, neither has a glyph. -1 and one byte for anything broken
+int32_t utf8_reference(const unsigned char *text, uint32_t len, uint32_t *used) {
+  *used = 1;
+  unsigned char c = text[0];
+  if (c < 0x80)return c;
+  uint32_t count = c >= 0xF0 && c < 0xF8 ? 3 : c >= 0xE0 && c < 0xF0 ? 2 : c >= 0xC0 && c < 0xE0 ? 1 : 0;
+  if (!count || count >= len)return -1;
+  uint32_t codePoint = c & (0x3F >> count);
+  for (uint32_t i = 1; i <= count; i++) {
+    if ((text[i] & 0xC0) != 0x80)return -1;
+    codePoint = codePoint << 6 | (text[i] & 0x3F);
+  }
+  static const uint32_t minimum[] = {0, 0x80, 0x800, 0x10000};
+  *used = count + 1;
+  return codePoint < minimum[count] ? -1 : codePoint;
+}
+
+int16_t utf8_reference_glyph(const unsigned char *text, uint32_t len, uint32_t *used) {
+  int32_t codePoint = utf8_reference(text, len, used);
+  if (codePoint < 0)return -1;
+  if (codePoint < 0x80)return codePoint < 32 || codePoint == 127 ? -1 : codePoint;
+  return decodeCodePoint(codePoint);
+}
+
+//glyphs of a whole buffer, the way displayPrintln() walks it
+uint32_t utf8_glyphs(const unsigned char *text, uint32_t len, int16_t *glyphs, bool reference) {
+  uint32_t count = 0;
+  uint32_t used;
+  for (uint32_t i = 0; i < len; i += used) {
+    int16_t glyph = reference ? utf8_reference_glyph(&text[i], len - i, &used) : decodeUtf8(&text[i], len - i, &used);
+    check(used >= 1 && used <= 4 && i + used <= len, "used stays inside the buffer", used);
+    check(glyph == -1 || glyph == 2 || (glyph >= 32 && glyph <= 254), "glyph in the font", glyph);
+    if (glyph >= 0)glyphs[count++] = glyph;
+  }
+  return count;
+}
+
+void test_tables() {
+  unsigned char text[4];
+  uint32_t used;
+  for (uint32_t codePoint = 0xA0; codePoint <= 0x17F; codePoint++) {
+    uint32_t len = utf8_encode(codePoint, text);
+    int16_t glyph = decodeUtf8(text, len, &used);
+    check(glyph > 0 && glyph == decodeCodePoint(codePoint), "every Latin-1 and Latin Extended-A letter has its glyph", codePoint);
+    check(used == 2, "two bytes used", codePoint);
+    check(decodeUtf8(text, 1, &used) == -1 && used == 1, "truncated after the lead byte", codePoint);
+    //overlong: the same code point in three and four bytes
+    unsigned char overlong[4] = {0xE0, (unsigned char)(0x80 | codePoint >> 6), (unsigned char)(0x80 | (codePoint & 0x3F))};
+    check(decodeUtf8(overlong, 3, &used) == -1 && used == 3, "overlong in three bytes", codePoint);
+    unsigned char overlong4[4] = {0xF0, 0x80, (unsigned char)(0x80 | codePoint >> 6), (unsigned char)(0x80 | (codePoint & 0x3F))};
+    check(decodeUtf8(overlong4, 4, &used) == -1 && used == 4, "overlong in four bytes", codePoint);
+    //the continuation byte replaced by ASCII or by a new lead byte
+    unsigned char broken[4] = {text[0], 'A'};
+    check(decodeUtf8(broken, 2, &used) == -1 && used == 1, "ASCII where the continuation belongs", codePoint);
+    check(decodeUtf8(&broken[1], 1, &used) == 'A', "the ASCII letter is still drawn", codePoint);
+    unsigned char restart[4] = {text[0], text[0], text[1]};
+    int16_t glyphs[4];
+    check(utf8_glyphs(restart, 3, glyphs, false) == 1 && glyphs[0] == decodeCodePoint(codePoint), "a lead byte where the continuation belongs starts over", codePoint);
+  }
+  for (uint32_t c = 0; c < 0x80; c++) {
+    unsigned char overlong[2] = {(unsigned char)(0xC0 | c >> 6), (unsigned char)(0x80 | (c & 0x3F))};
+    check(decodeUtf8(overlong, 2, &used) == -1, "ASCII as an overlong two byte sequence", c);
+  }
+  for (uint32_t c = 0x80; c < 0xC0; c++) {
+    unsigned char lone[1] = {(unsigned char)c};
+    check(decodeUtf8(lone, 1, &used) == -1 && used == 1, "a lone continuation byte", c);
+  }
+  unsigned char emoji[4];
+  utf8_encode(0x1F600, emoji);
+  check(decodeUtf8(emoji, 4, &used) == 2 && used == 4, "emojis are a smiley", 0x1F600);
+  check(decodeUtf8(emoji, 3, &used) == -1 && used == 1, "a truncated emoji", 0x1F600);
+}
+
+void test_random(uint32_t buffers) {
+  unsigned char text[24];
+  int16_t glyphs[24], expected[24];
+  for (uint32_t n = 0; n < buffers; n++) {
+    uint32_t len = 1 + utf8_random() % sizeof(text);
+    for (uint32_t i = 0; i < len; i++) {
+      switch (utf8_random() % 4) {
+        case 0://ASCII
+          text[i] = utf8_random() % 0x80;
+          break;
+        case 1://continuation
+          text[i] = 0x80 | utf8_random() % 0x40;
+          break;
+        case 2://lead byte of the tables
+          text[i] = 0xC2 + utf8_random() % 4;
+          break;
+        default:
+          text[i] = utf8_random();
+          break;
+      }
+    }
+    uint32_t count = utf8_glyphs(text, len, glyphs, false);
+    uint32_t expectedCount = utf8_glyphs(text, len, expected, true);
+    bool same = count == expectedCount && !memcmp(glyphs, expected, count * sizeof(glyphs[0]));
+    check(same, "random bytes decode like the reference", n);
+  }
+}
+
+int host_main(int argc, char **argv) {
+  uint32_t buffers = argc > 1 ? atoi(argv[1]) : 1000000;
+  test_tables();
+  test_random(buffers);
+  printf("%u random buffers, %u failures\n", buffers, check_failures);
+  return check_failures != 0;
+}
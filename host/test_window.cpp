@@ -0,0 +1,70 @@
+#include "emu.h"
+
+#include "Arduino.h"
+#include "display.h"
+#include "fast_spi.h"
+#include "pinout.h"
+
+//a window setup for DISPLAY_WINDOW_LIST_BYTES of pixels or more is one list of five 4 byte parts, GPIOTE toggles
+//D/C on every END. The panel has to see NOP NOP NOP CASET as commands, the CASET arguments as data and so on, and
+//data again for the pixels. Smaller windows are set up with single byte commands between two LCD_RS writes
+
+void test_trace(uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+  static emu_trace_struct trace[64];
+  uint8_t pixels[4] = {0x12, 0x34, 0x56, 0x78};
+  uint32_t row = y + h - 1;
+  const emu_trace_struct list[] = {
+    {ST77XX_NOP, 0}, {ST77XX_NOP, 0}, {ST77XX_NOP, 0}, {ST77XX_CASET, 0},
+    {0, 1}, {(uint8_t)x, 1}, {0, 1}, {(uint8_t)(x + w - 1), 1},
+    {ST77XX_NOP, 0}, {ST77XX_NOP, 0}, {ST77XX_NOP, 0}, {ST77XX_RASET, 0},
+    {(uint8_t)(y >> 8), 1}, {(uint8_t)y, 1}, {(uint8_t)(row >> 8), 1}, {(uint8_t)row, 1},
+    {ST77XX_NOP, 0}, {ST77XX_NOP, 0}, {ST77XX_NOP, 0}, {ST77XX_RAMWR, 0},
+    {0x12, 1}, {0x34, 1}, {0x56, 1}, {0x78, 1},
+  };
+  const emu_trace_struct single[] = {
+    {ST77XX_CASET, 0}, {0, 1}, {(uint8_t)x, 1}, {0, 1}, {(uint8_t)(x + w - 1), 1},
+    {ST77XX_RASET, 0}, {(uint8_t)(y >> 8), 1}, {(uint8_t)y, 1}, {(uint8_t)(row >> 8), 1}, {(uint8_t)row, 1},
+    {ST77XX_RAMWR, 0},
+    {0x12, 1}, {0x34, 1}, {0x56, 1}, {0x78, 1},
+  };
+  bool useList = w * h * 2 >= DISPLAY_WINDOW_LIST_BYTES;
+  const emu_trace_struct *expected = useList ? list : single;
+  uint32_t count = useList ? sizeof(list) / sizeof(list[0]) : sizeof(single) / sizeof(single[0]);
+  emu_reset_stats();
+  emu_trace(trace, 64);
+  startWrite();
+  setAddrWindowDisplay(x, y, w, h);
+  write_fast_spi(pixels, 4);
+  endWrite();
+  uint32_t length = emu_trace_length();
+  emu_trace(NULL, 0);
+  check(length == count, "bytes sent for a window and two pixels", length);
+  for (uint32_t i = 0; i < count && i < length; i++)
+    check(trace[i].data == expected[i].data && trace[i].dc == expected[i].dc, "byte and D/C level", i);
+  emu_stats_struct stats = emu_get_stats();
+  if (useList) {
+    check(stats.cpu_starts == 2, "one DMA start for the window and one for the pixels", stats.cpu_starts);
+    check(stats.dc_toggles == 5, "D/C toggled by GPIOTE after every part", stats.dc_toggles);
+    check(stats.windows == 1 && stats.nops == 9, "one RAMWR and the padding NOPs", stats.nops);
+  } else {
+    check(stats.cpu_starts == 6, "a DMA start for every command and argument and one for the pixels", stats.cpu_starts);
+    check(stats.dc_toggles == 0, "no D/C toggled by GPIOTE", stats.dc_toggles);
+    check(stats.windows == 1 && stats.nops == 0, "one RAMWR and no NOPs", stats.nops);
+  }
+  check(digitalRead(LCD_RS) == HIGH, "LCD_RS is left at data level");
+}
+
+int host_main(int argc, char **argv) {
+  init_fast_spi();
+  init_display();
+  test_trace(10, 20, 30, 40);
+  test_trace(0, 0, 240, 240);
+  test_trace(239, 200, 1, 64);
+  test_trace(5, 255, 8, 8);//a row above 255 needs the high byte
+  test_trace(5, 255, 1, 1);
+  test_trace(100, 100, 8, 7);//one pixel row short of the list
+  test_trace(239, 300, 1, 20);
+  if (emu_errors())printf("emulator errors: %u, first: %s\n", emu_errors(), emu_first_error());
+  printf("%u failures\n", check_failures);
+  return check_failures || emu_errors();
+}